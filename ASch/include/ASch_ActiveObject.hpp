@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_ActiveObject.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   ActiveObject
+//! @brief   This is the active object module of ASch.
+//! 
+//! An active object is a component that owns a private event queue, a priority and a dispatch function. Events posted
+//! to an object are queued only in its own queue, so a component that floods its queue cannot block the others and each
+//! queue can be sized for its own component. The scheduler main loop dispatches one event of the highest priority
+//! non-empty object at a time.
+
+#ifndef ASCH_ACTIVEOBJECT_HPP_
+#define ASCH_ACTIVEOBJECT_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <ASch_Configuration.hpp>
+#include <ASch_System.hpp>
+#include <Utils_Queue.hpp>
+#include <Hal_Isr.hpp>
+#include <Hal_System.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+typedef uint8_t activeObjectId_t;   //!< An active object ID type.
+
+const activeObjectId_t invalidActiveObjectId = 0xFFU;   //!< An ID that refers to no active object.
+const uint8_t activeObjectPrioritiesMax = 32U;          //!< Number of active object priorities.
+
+static_assert(Config::activeObjectsMax <= activeObjectPrioritiesMax, "Too many active objects in the configuration.");
+
+/// @brief This is an active object event struct.
+typedef struct
+{
+    uint16_t signal;        //!< Signal that identifies the event.
+    const void* pPayload;   //!< A pointer to the optional event payload.
+} aoEvent_t;
+
+typedef void (*aoDispatcher_t)(aoEvent_t const& event); //!< A function pointer type for active object dispatchers.
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//! @class   ActiveObject
+//! @brief   This class manages active objects.
+//! Each object has a unique priority from 0 to activeObjectPrioritiesMax - 1, higher value being more urgent. The queue
+//! storage is given by the creator, so every object can have a queue of its own size. Events are run to completion in
+//! the scheduler main loop.
+class ActiveObject
+{
+public:
+    explicit ActiveObject(void) {};
+
+    /// @brief This function initialises the active object module. All the objects are removed.
+    static void Init(void);
+
+    /// @brief This function creates an active object.
+    /// @param Dispatch - A function pointer to the dispatch function of the object.
+    /// @param priority - Unique priority of the object.
+    /// @param pQueue - A pointer to the event queue storage of the object.
+    /// @param queueSize - Number of events in the queue storage.
+    /// @return ID of the object, or invalidActiveObjectId if the object could not be created.
+    static activeObjectId_t Create(aoDispatcher_t Dispatch, uint8_t priority, aoEvent_t* pQueue, std::size_t queueSize);
+
+    /// @brief This function creates an active object with a statically allocated queue.
+    /// @param Dispatch - A function pointer to the dispatch function of the object.
+    /// @param priority - Unique priority of the object.
+    /// @param queue - A reference to the event queue storage array of the object.
+    /// @return ID of the object, or invalidActiveObjectId if the object could not be created.
+    template <std::size_t queueSize>
+    static activeObjectId_t Create(aoDispatcher_t Dispatch, uint8_t priority, aoEvent_t (&queue)[queueSize])
+    {
+        return Create(Dispatch, priority, queue, queueSize);
+    }
+
+    /// @brief This function posts an event to an active object. May be called from ISR context.
+    /// A full queue affects only the object it belongs to: the event is dropped and the caller is informed.
+    /// @param object - ID of the object.
+    /// @param event - A reference to the event.
+    /// @return True if the event was dropped because the queue of the object is full.
+    static bool Post(activeObjectId_t object, aoEvent_t const& event);
+
+    /// @brief This function returns the number of events in the queue of an object.
+    /// @param object - ID of the object.
+    /// @return Number of queued events.
+    static std::size_t GetNumberOfEvents(activeObjectId_t object);
+
+    /// @brief This function returns the number of events dropped because the queue of an object was full.
+    /// @param object - ID of the object.
+    /// @return Number of dropped events.
+    static uint32_t GetDroppedEventCount(activeObjectId_t object);
+
+    /// @brief This function dispatches one event of the highest priority object that has queued events.
+    /// Called from the scheduler main loop.
+    /// @return True if an event was dispatched.
+    static bool Run(void);
+
+#if (UNIT_TEST == 1)
+    /// @brief This function is used to deinitialise the module in unit tests.
+    static void Deinit(void);
+#endif
+
+private:
+    /// @brief This is an active object control block.
+    typedef struct
+    {
+        aoDispatcher_t Dispatch;                //!< A function pointer to the dispatch function. Zero for free slots.
+        Utils::QueueView<aoEvent_t> queue;      //!< Event queue over the storage given by the creator.
+        uint32_t droppedEventCount;             //!< Number of dropped events.
+        uint8_t priority;                       //!< Priority of the object.
+    } activeObject_t;
+
+    /// @brief This function checks that an object ID refers to a created object and raises a system error if it does not.
+    /// @param object - ID of the object.
+    /// @return True if the object is valid.
+    static bool IsValid(activeObjectId_t object);
+
+    /// @brief This function checks if a created object already has the given priority.
+    /// @param priority - The priority.
+    /// @return True if the priority is taken.
+    static bool IsPriorityTaken(uint8_t priority);
+
+    static activeObject_t objects[Config::activeObjectsMax];        //!< Active object control blocks.
+    static activeObjectId_t priorityToObject[activeObjectPrioritiesMax];    //!< Object IDs by priority.
+    static volatile uint32_t readyPriorities;   //!< A bitmask of the priorities that have queued events.
+};
+
+} // namespace ASch
+
+#endif // ASCH_ACTIVEOBJECT_HPP_
@@ -0,0 +1,145 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Arena.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Arena
+//! @brief   This is the init-phase memory arena of ASch.
+//! 
+//! The arena gives memory to structures that are sized at boot, e.g. in the pre-start configuration functions. Memory is
+//! taken by advancing a pointer and it is never freed. The scheduler seals the arena when it is started, so the memory
+//! usage cannot change once the system is running. The arena is placed in the RAM region selected with ARENA_SECTION in
+//! the configuration.
+
+#ifndef ASCH_ARENA_HPP_
+#define ASCH_ARENA_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <ASch_Configuration.hpp>
+#include <ASch_System.hpp>
+#include <new>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//! @class   Arena
+//! @brief   This class manages the init-phase memory arena.
+//! The arena is used from the main context before the scheduler is started. It must not be used from ISRs. The memory
+//! taken by each owner is recorded, so the RAM budget of the modules can be reported at runtime.
+class Arena
+{
+public:
+    explicit Arena(void) {};
+
+    /// @brief This function allocates memory from the arena.
+    /// A system error is raised if the parameters are invalid, if the arena is sealed, or if the arena is exhausted.
+    /// @param owner - The module that owns the memory.
+    /// @param size - Size of the memory in bytes.
+    /// @param alignment - Alignment of the memory in bytes. Must be a power of two.
+    /// @return A pointer to the memory, or zero if the allocation failed.
+    static void* Allocate(ArenaOwner owner, std::size_t size, std::size_t alignment);
+
+    /// @brief This function allocates an array of elements from the arena and constructs the elements.
+    /// A system error is raised if the size of the array does not fit into std::size_t.
+    /// @param owner - The module that owns the memory.
+    /// @param count - Number of elements.
+    /// @param args - The constructor arguments of each element. They are passed to every element as lvalues, so they are
+    /// never moved from.
+    /// @return A pointer to the first element, or zero if the allocation failed.
+    template <typename T, typename... Args>
+    static T* Create(ArenaOwner owner, std::size_t count, Args&&... args)
+    {
+        T* pElements = 0;
+
+        if (count > (SIZE_MAX / sizeof(T)))
+        {
+            System::Error(SysError::invalidParameters);
+        }
+        else
+        {
+            pElements = static_cast<T*>(Allocate(owner, count * sizeof(T), alignof(T)));
+        }
+
+        for (std::size_t i = 0U; (pElements != 0) && (i < count); ++i)
+        {
+            new (&pElements[i]) T(args...);
+        }
+        return pElements;
+    }
+
+    /// @brief This function seals the arena. Allocations fail after this. Called when the scheduler is started.
+    static void Seal(void);
+
+    /// @brief This function checks if the arena is sealed.
+    /// @return True if the arena is sealed.
+    static bool IsSealed(void);
+
+    /// @brief This function returns the number of bytes taken by an owner, including the alignment padding of its
+    /// allocations.
+    /// @param owner - The module that owns the memory.
+    /// @return Number of bytes, or zero if the owner is invalid.
+    static std::size_t GetUsage(ArenaOwner owner);
+
+    /// @brief This function returns the number of bytes taken from the arena.
+    /// @return Number of bytes.
+    static std::size_t GetTotalUsage(void);
+
+    /// @brief This function returns the number of bytes left in the arena.
+    /// @return Number of bytes.
+    static std::size_t GetFree(void);
+
+#if (UNIT_TEST == 1)
+    /// @brief This function is used to deinitialise the module in unit tests.
+    static void Deinit(void);
+#endif
+
+private:
+    static const std::size_t ownerCount = static_cast<std::size_t>(ArenaOwner::invalid);    //!< Number of owners.
+
+    static uint64_t memory[(Config::arenaSize + 7U) / 8U];  //!< The arena memory.
+    static std::size_t usedBytes;                           //!< Number of bytes taken from the arena.
+    static std::size_t ownerUsage[ownerCount];              //!< Number of bytes taken by each owner.
+    static bool isSealed;                                   //!< An indication that the arena is sealed.
+};
+
+} // namespace ASch
+
+#endif // ASCH_ARENA_HPP_
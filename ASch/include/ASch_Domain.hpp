@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Domain.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Domain
+//! @brief   This is a scheduler domain of ASch.
+//! 
+//! A domain is an independent scheduler instance with its own task table, event queue and tick source. The static
+//! Scheduler remains the main loop domain of the system, and additional domains separate the work of different rates,
+//! e.g. a high-rate domain that is ticked and run in a timer interrupt. Since the domains do not share a queue, a burst in
+//! one domain does not delay the events of another.
+
+#ifndef ASCH_DOMAIN_HPP_
+#define ASCH_DOMAIN_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <ASch_Scheduler.hpp>
+#include <ASch_System.hpp>
+#include <Hal_Isr.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+/// @brief This is a task table entry of a domain.
+typedef struct
+{
+    uint16_t intervalInMs;  //!< Task interval in milliseconds.
+    taskHandler_t Task;     //!< A function pointer for the task.
+    uint16_t msCounter;     //!< Time to the next activation in milliseconds.
+    bool isDue;             //!< An indication that the task has been activated and not yet run.
+} domainTask_t;
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//! @class   Domain
+//! @brief   This class is an independent scheduler instance.
+//! The domain is driven by its owner: Tick() is called from the tick source of the domain and Run() from the context that
+//! runs the domain, e.g. both from the same timer interrupt or Tick() from a timer interrupt and Run() from the main loop.
+//! The storage of the task table and the event queue is given in the constructor, so each domain has its own capacities.
+//! Tasks and events may be created and pushed from any context.
+class Domain
+{
+public:
+    /// @brief Constructor.
+    /// @param tickIntervalInMs - Interval of the tick source in milliseconds. Must not be zero.
+    /// @param tasks - A reference to the task table storage.
+    /// @param events - A reference to the event queue storage.
+    template <std::size_t tasksMax, std::size_t eventsMax>
+    Domain(uint16_t tickIntervalInMs, domainTask_t (&tasks)[tasksMax], event_t (&events)[eventsMax]) :
+        msPerTick(tickIntervalInMs),
+        pTasks(tasks),
+        taskCapacity(tasksMax),
+        taskCount(0U),
+        pEvents(events),
+        eventCapacity(eventsMax),
+        eventCount(0U),
+        nextEvent(0U),
+        isPending(false)
+    {};
+
+    /// @brief This function creates a task. If the task already exists, its interval is updated.
+    /// @param task - Task configuration struct. The task must have a non-zero interval. The preemption level, the WCET and
+    /// the criticality are not used by domains.
+    void CreateTask(task_t const& task);
+
+    /// @brief This function deletes a task.
+    /// @param Task - A function pointer to the task.
+    void DeleteTask(taskHandler_t Task);
+
+    /// @brief This function returns the current task count.
+    /// @return Task count.
+    std::size_t GetTaskCount(void) const;
+
+    /// @brief This function pushes an event into the event queue of the domain.
+    /// @param event - A reference to the event.
+    void PushEvent(event_t const& event);
+
+    /// @brief This function returns the number of pending events.
+    /// @return Number of events.
+    std::size_t GetNumberOfEvents(void) const;
+
+    /// @brief This function advances the task counters by one tick and activates the due tasks.
+    /// Called from the tick source of the domain.
+    void Tick(void);
+
+    /// @brief This function runs the activated tasks and then the pending events, including the events that the handlers
+    /// push.
+    /// @return True if anything was run.
+    bool Run(void);
+
+private:
+    /// @brief This function pops the next pending event.
+    /// @param event - A reference to the popped event.
+    /// @return True if an event was popped.
+    bool PopEvent(event_t& event);
+
+    uint16_t msPerTick;         //!< How many ms is one tick.
+    domainTask_t* pTasks;       //!< Task table.
+    std::size_t taskCapacity;   //!< Size of the task table.
+    std::size_t taskCount;      //!< Current task count.
+    event_t* pEvents;           //!< Event queue ring buffer.
+    std::size_t eventCapacity;  //!< Size of the event queue.
+    std::size_t eventCount;     //!< Number of pending events.
+    std::size_t nextEvent;      //!< Index of the next event to be run.
+    volatile bool isPending;    //!< An indication that tasks have been activated.
+};
+
+} // namespace ASch
+
+#endif // ASCH_DOMAIN_HPP_
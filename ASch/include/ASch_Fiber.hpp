@@ -0,0 +1,170 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Fiber.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Fiber
+//! @brief   This is the fiber module of ASch.
+//! 
+//! Fibers are cooperative threads with their own fixed-size stacks. They allow code written in a blocking style to run
+//! alongside tasks and events: a fiber yields to the scheduler main loop when it calls Delay() or Wait() and the main loop
+//! resumes it when the delay has elapsed or a waited event has been signalled.
+
+#ifndef ASCH_FIBER_HPP_
+#define ASCH_FIBER_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <ASch_Configuration.hpp>
+#include <ASch_System.hpp>
+#include <Hal_Context.hpp>
+#include <Hal_Isr.hpp>
+#include <Hal_System.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+typedef void (*fiberHandler_t)(void);   //!< A function pointer type for fiber handlers.
+typedef uint8_t fiberId_t;              //!< A fiber ID type.
+
+const fiberId_t invalidFiberId = 0xFFU; //!< An ID that refers to no fiber.
+
+static_assert(Config::fibersMax < invalidFiberId, "Too many fibers for the fiber ID type.");
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//! @class   Fiber
+//! @brief   This class manages cooperative fibers.
+//! The scheduler main loop runs the fibers that are ready and the scheduler tick handler times their delays. A fiber
+//! ends when its handler returns and its slot can then be reused.
+class Fiber
+{
+public:
+    explicit Fiber(void) {};
+
+    /// @brief This function initialises the fiber module. All the fibers are removed.
+    static void Init(void);
+
+    /// @brief This function creates a fiber. The fiber is started by the next main loop round.
+    /// @param Handler - A function pointer to the fiber handler.
+    /// @return ID of the fiber, or invalidFiberId if there is no free fiber slot.
+    static fiberId_t Create(fiberHandler_t Handler);
+
+    /// @brief This function suspends the calling fiber for the given time. Zero just yields to the main loop.
+    /// May be called only from a fiber.
+    /// @param delayInMs - Delay in milliseconds.
+    static void Delay(uint32_t delayInMs);
+
+    /// @brief This function suspends the calling fiber until any of the given events has been signalled.
+    /// May be called only from a fiber.
+    /// @param events - A bitmask of the waited events.
+    /// @return The signalled events of the mask. The returned events are cleared.
+    static uint32_t Wait(uint32_t events);
+
+    /// @brief This function signals events to a fiber. May be called from ISR context.
+    /// @param fiber - ID of the fiber.
+    /// @param events - A bitmask of the events.
+    static void Signal(fiberId_t fiber, uint32_t events);
+
+    /// @brief This function returns the ID of the running fiber.
+    /// @return ID of the running fiber, or invalidFiberId if called outside fibers.
+    static fiberId_t GetCurrent(void);
+
+    /// @brief This function runs the fibers that are ready until each of them yields. Called from the main loop.
+    /// @return True if any fiber was run.
+    static bool Run(void);
+
+    /// @brief This function advances the fiber delays. Called from the scheduler tick handler.
+    /// @param elapsedInMs - Time elapsed since the previous call in milliseconds.
+    static void Tick(uint32_t elapsedInMs);
+
+#if (UNIT_TEST == 1)
+    /// @brief This function is used to deinitialise the module in unit tests.
+    static void Deinit(void);
+#endif
+
+private:
+    /// @brief This is a fiber state enum.
+    enum class FiberState
+    {
+        free = 0,   //!< The fiber slot is free.
+        ready,      //!< The fiber is ready to run.
+        delayed,    //!< The fiber waits for its delay to elapse.
+        waiting     //!< The fiber waits for events.
+    };
+
+    /// @brief This is a fiber control block.
+    typedef struct
+    {
+        fiberHandler_t Handler;             //!< A function pointer to the fiber handler.
+        Hal::context_t context;             //!< Saved execution context.
+        volatile FiberState state;          //!< Fiber state.
+        volatile uint32_t delayInMs;        //!< Remaining delay.
+        uint32_t waitedEvents;              //!< A bitmask of the waited events.
+        volatile uint32_t pendingEvents;    //!< A bitmask of the signalled events.
+    } fiber_t;
+
+    /// @brief This function checks if a fiber is ready to be resumed.
+    /// @param fiber - ID of the fiber.
+    /// @return True if the fiber is ready.
+    static bool IsReady(fiberId_t fiber);
+
+    /// @brief This function switches from the running fiber back to the main loop.
+    static void Yield(void);
+
+    /// @brief This is the entry function of all the fibers.
+    static void Entry(void);
+
+    /// @brief This function checks that the caller is a fiber and raises a system error if it is not.
+    /// @return True if the caller is a fiber.
+    static bool IsCalledFromFiber(void);
+
+    static fiber_t fibers[Config::fibersMax];   //!< Fiber control blocks.
+    static uint64_t stacks[Config::fibersMax][Config::fiberStackSize / sizeof(uint64_t)];   //!< Fiber stacks.
+    static Hal::context_t mainContext;          //!< Saved context of the main loop.
+    static fiberId_t currentFiber;              //!< ID of the running fiber.
+};
+
+} // namespace ASch
+
+#endif // ASCH_FIBER_HPP_
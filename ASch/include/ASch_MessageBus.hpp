@@ -0,0 +1,132 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_MessageBus.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   MessageBus
+//! @brief   This is a type-safe message bus of ASch.
+//! 
+//! Message types of the bus are C++ types and the subscribers of a message type are declared statically by specialising
+//! Subscription<T> in the ASch namespace:
+//!
+//!     template<> struct Subscription<sample_t> : Subscribers<sample_t, &Filter, &Logger> {};
+//!
+//! Publish<T>() calls the subscribers directly, so the calls can be inlined. Post<T>() copies the message into the event
+//! queue and the subscribers are called when the scheduler runs the event. Post<T>() needs the inline payloads of the
+//! event queue, i.e. Config::eventInlinePayloadSize must be above zero.
+
+#ifndef ASCH_MESSAGEBUS_HPP_
+#define ASCH_MESSAGEBUS_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <ASch_Scheduler.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+/// @brief This is a static list of the subscribers of the message type T.
+template<typename T, void (*... Handlers)(T const&)>
+struct Subscribers
+{
+    /// @brief This function delivers a message to the subscribers in the declaration order.
+    /// @param message - A reference to the message.
+    static inline void Deliver(T const& message)
+    {
+        typedef int expander_t[];
+        (void)expander_t{0, (Handlers(message), 0)...};
+        return;
+    }
+};
+
+/// @brief These are the subscriptions of the message type T. A message type has no subscribers unless this is specialised.
+template<typename T>
+struct Subscription : Subscribers<T>
+{
+};
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//! @class   MessageBus
+//! @brief   This is a type-safe message bus.
+//! The bus has no state. All the routing is resolved at compile time from the Subscription<T> specialisations.
+class MessageBus
+{
+public:
+    /// @brief This function delivers a message to its subscribers immediately in the caller context.
+    /// @param message - A reference to the message.
+    template<typename T>
+    static inline void Publish(T const& message)
+    {
+        Subscription<T>::Deliver(message);
+        return;
+    }
+
+    /// @brief This function defers the delivery of a message through the scheduler event queue.
+    /// The message is copied into the event queue entry, so it must fit into Config::eventInlinePayloadSize bytes. The
+    /// inline payloads are disabled when the size is zero, and Post cannot be used then.
+    /// @param message - A reference to the message.
+    template<typename T>
+    static inline void Post(T const& message)
+    {
+        static_assert((sizeof(T) > 0U) && (Config::eventInlinePayloadSize > 0U),
+                      "MessageBus::Post needs inline payloads. Set Config::eventInlinePayloadSize above zero.");
+        static_assert(alignof(T) <= alignof(uint64_t), "The message type is aligned beyond an event queue entry.");
+        Scheduler::PushInlineEvent(DeliverDeferred<T>, message);
+        return;
+    }
+
+private:
+    /// @brief This function is the event handler of the deferred messages of type T.
+    /// @param pPayload - A pointer to the message copy in the event queue entry.
+    template<typename T>
+    static void DeliverDeferred(const void* pPayload)
+    {
+        Subscription<T>::Deliver(*static_cast<const T*>(pPayload));
+        return;
+    }
+};
+
+} // namespace ASch
+
+#endif // ASCH_MESSAGEBUS_HPP_
@@ -0,0 +1,138 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Preemption.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Preemption
+//! @brief   This is the preemptive priority level module of ASch.
+//! 
+//! The module runs events and tasks to completion at the priority levels of Config::preemptionLevels. Each level is run
+//! in a software triggered interrupt, so a higher level preempts the main loop and the lower levels with interrupt latency
+//! while all the levels share the single stack. Level zero is the cooperative main loop of the scheduler.
+
+#ifndef ASCH_PREEMPTION_HPP_
+#define ASCH_PREEMPTION_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <ASch_Configuration.hpp>
+#include <ASch_Scheduler.hpp>
+#include <ASch_System.hpp>
+#include <Utils_Queue.hpp>
+#include <Hal_Isr.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+const std::size_t preemptionLevelsMax = 8U; //!< Maximum number of supported preemption levels.
+
+static_assert(preemptionLevelCount <= preemptionLevelsMax, "Too many preemption levels in Config::preemptionLevels.");
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//! @class   Preemption
+//! @brief   This class runs events and tasks at preemptive priority levels.
+//! Work posted to a level is queued and the interrupt of the level is set pending. The interrupt handler runs the queued
+//! work one item at a time to completion. Data shared between levels must be protected with critical sections.
+class Preemption
+{
+public:
+    explicit Preemption(void) {};
+
+    /// @brief This function initialises the preemption levels and enables their interrupts.
+    static void Init(void);
+
+    /// @brief This function posts an event to the given level.
+    /// Level zero pushes the event into the scheduler event queue. May be called from any level and from ISRs.
+    /// @param level - Preemption level.
+    /// @param event - A reference to the event.
+    static void PostEvent(uint8_t level, event_t const& event);
+
+    /// @brief This function posts a task activation to the given level. The level must be one or higher.
+    /// @param level - Preemption level.
+    /// @param Task - A function pointer to the task.
+    static void PostTask(uint8_t level, taskHandler_t Task);
+
+    /// @brief This function returns the level that is currently running.
+    /// @return Current level. Zero if no preemption level is running.
+    static uint8_t GetCurrentLevel(void);
+
+#if (UNIT_TEST == 1)
+    /// @brief This function is used to deinitialise the module in unit tests.
+    static void Deinit(void);
+#endif
+
+private:
+    /// @brief This is a work item of a preemption level.
+    typedef struct
+    {
+        eventHandler_t Handler; //!< A function pointer to the event handler. Zero for task activations.
+        const void* pPayload;   //!< A pointer to the optional event payload.
+        taskHandler_t Task;     //!< A function pointer to the task. Zero for events.
+    } job_t;
+
+    /// @brief This function queues a work item and sets the interrupt of the level pending.
+    /// @param level - Preemption level.
+    /// @param job - A reference to the work item.
+    static void PostJob(uint8_t level, job_t const& job);
+
+    /// @brief This function runs the queued work items of a level to completion.
+    /// @param index - Index of the level in Config::preemptionLevels.
+    static void RunLevel(std::size_t index);
+
+    /// @brief This is the interrupt handler of a level.
+    template<std::size_t index>
+    static void LevelHandler(void)
+    {
+        RunLevel(index);
+        return;
+    }
+
+    static const Hal::interruptHandler_t levelHandlers[preemptionLevelsMax];    //!< Interrupt handlers of the levels.
+    static Utils::Queue<job_t, Config::preemptionEventsMax> levelQueues[preemptionLevelCount];  //!< Work queues of the levels.
+    static volatile uint8_t currentLevel;   //!< The level that is currently running.
+};
+
+} // namespace ASch
+
+#endif // ASCH_PREEMPTION_HPP_
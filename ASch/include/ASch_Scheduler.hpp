@@ -36,11 +36,14 @@
 #include <Utils_Types.hpp>
 #include <ASch_Configuration.hpp>
 #include <Utils_Queue.hpp>
+#include <Utils_Pool.hpp>
 #include <ASch_System.hpp>
 #include <Hal_SysTick.hpp>
 #include <Hal_Isr.hpp>
 #include <Hal_System.hpp>
 
+#include <type_traits>
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // 2. Typedefs, Structs, Enums and Constants
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -48,10 +51,6 @@
 namespace ASch
 {
 
-typedef void (*taskHandler_t)(void);            //!< A function pointer type for task handlers.
-typedef void (*eventHandler_t)(const void*);    //!< A function pointer type for event handlers.
-typedef void (*messageHandler_t)(const void*);  //!< A function pointer type for message handlers.
-
 /// @brief This is an event struct that is used to push events into the scheduler.
 typedef struct
 {
@@ -59,18 +58,14 @@ typedef struct
     const void* pPayload;   //!< A pointer to the optional payload.
 } event_t;
 
-/// @brief This is a task struct that is used to create tasks.
-typedef struct
-{
-    uint16_t intervalInMs;  //!< Task interval in milliseconds.
-    taskHandler_t Task;     //!< A function pointer for the task.
-} task_t;
-
 /// @brief This is a message listener struct that is used to create message listeners.
+/// A listener receives the messages of the given type and the messages that belong to any of the given topics. A listener
+/// that subscribes only to topics uses Message::invalid as the type.
 typedef struct
 {
     Message type;               //!< Message type.
     messageHandler_t Handler;   //!< A function pointer to the message handler.
+    uint32_t topics;            //!< Optional topic bitmask. See Topic namespace in the configuration.
 } messageListener_t;
 
 /// @brief This is a message struct that is used to push messages.
@@ -80,6 +75,89 @@ typedef struct
     const void* pPayload;   //!< Pointer to the message payload.
 } message_t;
 
+typedef Utils::IndexType<Config::schedulerTasksMax>::type taskId_t;       //!< A task ID and count type.
+typedef Utils::IndexType<Config::payloadBlocksMax>::type payloadHandle_t; //!< A handle of a message payload pool block.
+const payloadHandle_t noPayloadHandle = 0U;     //!< A handle value that refers to no payload pool block.
+
+/// @brief This is an event queue overflow policy enum.
+enum class EventOverflowPolicy
+{
+    systemError = 0,    //!< A system error is raised. This is the default policy.
+    dropNewest,         //!< The pushed event is dropped.
+    dropOldest          //!< The oldest pending event is dropped to make room for the pushed event.
+};
+
+/// @brief This is a task admission policy enum. The policy decides what CreateTask does with a task that would make the
+/// task set exceed the Liu-Layland utilisation bound.
+enum class AdmissionPolicy
+{
+    none = 0,   //!< No admission control. This is the default policy.
+    flag,       //!< The task is created and IsSchedulable() reports the task set unschedulable.
+    reject      //!< The task is not created and CreateTask reports the rejection. Periodic tasks must declare a WCET.
+};
+
+/// @brief This is the inline payload storage of an event queue entry. The storage is aligned for any scalar payload.
+template <std::size_t size>
+struct InlinePayloadStorage
+{
+    uint64_t words[(size + 7U) / 8U];   //!< Payload data.
+
+    /// @brief This function returns a pointer to the payload data.
+    /// @return A pointer to the data.
+    void* GetData(void)
+    {
+        return static_cast<void*>(words);
+    }
+
+    /// @brief This function returns a pointer to the payload data.
+    /// @return A pointer to the data.
+    const void* GetData(void) const
+    {
+        return static_cast<const void*>(words);
+    }
+
+    /// @brief Compares the payload data of two storages.
+    /// @param other - The storage to compare with.
+    /// @return True if the data is equal.
+    bool operator==(InlinePayloadStorage const& other) const
+    {
+        bool isEqual = true;
+        for (std::size_t i = 0U; i < ((size + 7U) / 8U); ++i)
+        {
+            isEqual = isEqual && (words[i] == other.words[i]);
+        }
+        return isEqual;
+    }
+};
+
+/// @brief This is a specialisation for disabled inline payloads. It does not grow the event queue entries.
+template <>
+struct InlinePayloadStorage<0U>
+{
+    void* GetData(void)
+    {
+        return 0;
+    }
+
+    const void* GetData(void) const
+    {
+        return 0;
+    }
+
+    bool operator==(InlinePayloadStorage const& other) const
+    {
+        (void)other;
+        return true;
+    }
+};
+
+typedef void (*eventOverflowHandler_t)(event_t const&);   //!< A function pointer type for event overflow notifications.
+
+/// @brief A function pointer type for background jobs. A job does one slice of its work per call and keeps its own
+/// progress between the calls.
+/// @return True when the job has finished.
+typedef bool (*backgroundJob_t)(void);
+
 /// @brief This is a scheduler status enum.
 enum class SchedulerStatus
 {
@@ -138,11 +216,72 @@ public:
 
     /// @brief This function returns the current task count.
     /// @return Current task count.
-    static uint8_t GetTaskCount(void);
+    static taskId_t GetTaskCount(void);
 
     /// @brief This function creates a given task.
+    /// A task with zero interval is a pipeline stage that is run only when it is released by its predecessors. A level
+    /// above the configured preemption levels raises a system error.
     /// @param task - Task configuration struct.
-    static void CreateTask(task_t task);
+    /// @return True if the task was not created, e.g. because it was rejected by the admission policy.
+    static bool CreateTask(task_t task);
+
+    /// @brief This function links two main loop tasks into a task dependency graph.
+    /// The successor is released when all its predecessors have completed since its previous run, and it is run in the
+    /// same RunTasks pass. The link is rejected if it would create a dependency loop.
+    /// @param Predecessor - A function pointer to the predecessor task.
+    /// @param Successor - A function pointer to the successor task.
+    static void LinkTasks(taskHandler_t Predecessor, taskHandler_t Successor);
+
+    /// @brief This function sets the policy that CreateTask applies to tasks that fail the schedulability test.
+    /// @param policy - Admission policy.
+    static void SetAdmissionPolicy(AdmissionPolicy policy);
+
+    /// @brief This function returns the worst-case execution time of a task. The declared time is returned if the task
+    /// has one. Otherwise the longest measured run time of the task in the main loop is returned.
+    /// @param taskId - Task ID
+    /// @return Worst-case execution time in microseconds.
+    static uint32_t GetTaskWcet(taskId_t taskId);
+
+    /// @brief This function returns the total CPU utilisation of the periodic tasks.
+    /// @return Utilisation in parts per million.
+    static uint32_t GetUtilisation(void);
+
+    /// @brief This function checks the task set against the Liu-Layland utilisation bound.
+    /// Pipeline stages with zero interval are not included in the test.
+    /// @return True if the task set passes the test.
+    static bool IsSchedulable(void);
+
+    /// @brief This function enables or disables the elastic mode. The mode is disabled by default.
+    /// In the elastic mode the scheduler measures the main loop load and the deadline misses of the tasks, and degrades the
+    /// low criticality tasks during overload. See the elastic mode thresholds in the configuration.
+    /// @param isEnabled - True to enable the elastic mode.
+    static void SetElasticMode(bool isEnabled);
+
+    /// @brief This function checks if the scheduler is in overload.
+    /// @return True during overload.
+    static bool IsOverloaded(void);
+
+    /// @brief This function returns the main loop load of the previous measurement window.
+    /// @return Load in parts per million.
+    static uint32_t GetLoad(void);
+
+    /// @brief This function returns the number of task activations that were due while the previous activation had not
+    /// yet been run. Counted only in the elastic mode.
+    /// @return Number of deadline misses.
+    static uint32_t GetDeadlineMissCount(void);
+
+    /// @brief This function switches the scheduler to a schedule mode, i.e. replaces the task set with the precomputed task
+    /// set of the mode in Config::scheduleModes. The switch is applied atomically at the next tick boundary, so a task of
+    /// the previous set is never activated after the switch. May be called from ISR context.
+    /// The tasks created with CreateTask are replaced as well. The links between the tasks that are in both sets are kept.
+    /// @param mode - The schedule mode.
+    /// @param isPhasePreserved - True to let the tasks that are in both sets keep their counters and pending activations.
+    /// Otherwise all the tasks start a full interval from the switch.
+    static void SwitchMode(ScheduleMode mode, bool isPhasePreserved);
+
+    /// @brief This function returns the active schedule mode.
+    /// @return Schedule mode, or ScheduleMode::invalid if no mode has been switched to since Init.
+    static ScheduleMode GetScheduleMode(void);
 
     /// @brief This function deletes the given task based on task handler.
     /// @param taskHandler - Function pointer to the task handler to be removed.
@@ -151,9 +290,9 @@ public:
     /// @brief This function return the task interval of the given task ID.
     /// @param taskId - Task ID
     /// @return Task interval in milliseconds.
-    static uint16_t GetTaskInterval(uint8_t taskId);
+    static uint16_t GetTaskInterval(taskId_t taskId);
     
-    /// @brief This function runs all the pending tasks.
+    /// @brief This function runs all the pending tasks and the pipeline stages they release.
     static void RunTasks(void);
 
     /// @brief This function puts the system in sleep mode.
@@ -163,29 +302,142 @@ public:
     static void WakeUp(void);
 
     /// @brief This function is used to push an event into the scheduler.
+    /// If event coalescing is enabled and an equal event is among the newest Config::eventCoalescingDepth pending events,
+    /// the push is merged into the pending event.
     /// @param event - A refernce to the event to be pushed.
     static void PushEvent(event_t const& event);
 
-    /// @brief This function runs all the pending events.
+    /// @brief This function is used to push an event with a small payload that is copied into the event queue entry.
+    /// The handler receives a pointer to the copy, so the producer does not need static storage for the payload.
+    /// The copy is valid until the handler returns.
+    /// @param Handler - A function pointer to the event handler.
+    /// @param pData - A pointer to the payload data.
+    /// @param size - Size of the payload in bytes. Must not exceed Config::eventInlinePayloadSize, which is zero unless the
+    /// inline payloads are enabled in the configuration.
+    static void PushInlineEvent(eventHandler_t Handler, const void* pData, std::size_t size);
+
+    /// @brief This function is used to push an event with a small payload of type T that is copied into the event queue entry.
+    /// The payload is copied byte-wise, so T must be trivially copyable.
+    /// @param Handler - A function pointer to the event handler.
+    /// @param data - A reference to the payload.
+    template<typename T>
+    static void PushInlineEvent(eventHandler_t Handler, T const& data)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "The payload is copied byte-wise, so it must be trivially copyable.");
+        static_assert(sizeof(T) <= Config::eventInlinePayloadSize, "The payload does not fit into an event queue entry.");
+        PushInlineEvent(Handler, static_cast<const void*>(&data), sizeof(T));
+        return;
+    }
+
+    /// @brief This function sets the policy that is applied when an event is pushed into a full event queue.
+    /// @param policy - Event overflow policy.
+    static void SetEventOverflowPolicy(EventOverflowPolicy policy);
+
+    /// @brief This function sets an optional handler that is notified of every dropped event.
+    /// The handler is called in the context of the push, i.e. possibly in ISR context. For a dropped message the handler of
+    /// the notified event is zero and the payload is the message payload.
+    /// @param Handler - Pointer to the handler. Zero disables the notification.
+    static void SetEventOverflowHandler(eventOverflowHandler_t Handler);
+
+    /// @brief This function returns the number of events dropped due to event queue overflow.
+    /// @return Number of dropped events.
+    static uint32_t GetDroppedEventCount(void);
+
+    /// @brief This function enables or disables event coalescing. Coalescing is disabled by default.
+    /// @param isEnabled - True to enable coalescing.
+    static void SetEventCoalescing(bool isEnabled);
+
+    /// @brief This function returns the number of pushes that have been merged into pending events.
+    /// @return Number of coalesced events.
+    static uint32_t GetCoalescedEventCount(void);
+
+    /// @brief This function runs the pending events.
+    /// The events are run in passes limited by schedulerEventsPerPass and schedulerEventCyclesPerPass. If tasks have become
+    /// due when a pass is spent, the function returns and the remaining events are run after the tasks.
     static void RunEvents(void);
 
     /// @brief This function is used to register a message listener.
+    /// A listener registered by a message handler receives the messages dispatched after the current one.
     /// @param listener - A reference to the listener to be registered.
     static void RegisterMessageListener(messageListener_t const& listener);
     
     /// @brief This function is used to unregister a message listener.
+    /// A message handler may unregister listeners, including itself. An unregistered listener receives no further messages.
     /// @param listener - A reference to the listener to be unregistered.
     static void UnregisterMessageListener(messageListener_t const& listener);
 
     /// @brief This function returns the current number of message listeners of given message type.
+    /// The listeners subscribed to a topic of the message type and the static routes of Config::messageRoutes are included
+    /// in the count.
     /// @param type - The type of message.
     /// @return Number of listeners.
-    static uint8_t GetNumberOfMessageListeners(Message type);
+    static std::size_t GetNumberOfMessageListeners(Message type);
     
     /// @brief This function pushes a message into the scheduler.
+    /// The message takes a single event queue slot regardless of the number of listeners. It is delivered to the listeners
+    /// that are registered when the message is run. Message::invalid is rejected with a system error.
     /// @param message - A reference to the message to be pushed.
     static void PushMessage(message_t const& message);
 
+    /// @brief This function allocates a block from the message payload pool.
+    /// The caller owns one reference to the block. May be called from ISR context.
+    /// @return Handle of the allocated block, or noPayloadHandle if the pool is exhausted.
+    static payloadHandle_t AllocatePayload(void);
+
+    /// @brief This function returns a pointer to the data of a payload pool block.
+    /// The block is Config::payloadBlockSize bytes long.
+    /// @param payload - Handle of the block.
+    /// @return Pointer to the block data, or zero if the handle is invalid.
+    static void* GetPayload(payloadHandle_t payload);
+
+    /// @brief This function adds a reference to a payload pool block. A block can have up to 255 references. Exceeding
+    /// the limit raises a system error and the reference is not added.
+    /// @param payload - Handle of the block.
+    static void RetainPayload(payloadHandle_t payload);
+
+    /// @brief This function releases a reference to a payload pool block. The block is freed with its last reference.
+    /// @param payload - Handle of the block.
+    static void ReleasePayload(payloadHandle_t payload);
+
+    /// @brief This function returns the number of free payload pool blocks.
+    /// @return Number of free blocks.
+    static std::size_t GetNumberOfFreePayloads(void);
+
+    /// @brief This function returns the highest number of payload pool blocks that have been allocated at the same time.
+    /// The value helps to size Config::payloadBlocksMax.
+    /// @return High-water mark of the payload pool.
+    static std::size_t GetPayloadHighWaterMark(void);
+
+    /// @brief This function returns the number of payload allocations that failed because the pool was exhausted.
+    /// @return Number of failed allocations.
+    static uint32_t GetPayloadAllocationFailureCount(void);
+
+    /// @brief This function pushes a message with a pooled payload into the scheduler.
+    /// The message takes over one reference of the caller. The reference is released after the last listener has returned,
+    /// so the payload is shared by all the listeners without copying. Message::invalid is rejected with a system error
+    /// and the reference is released.
+    /// @param type - The message type.
+    /// @param payload - Handle of the payload block.
+    static void PushPooledMessage(Message type, payloadHandle_t payload);
+
+    /// @brief This function starts a background job. The job is run in the idle time of the main loop until it has finished.
+    /// @param Job - A function pointer to the job.
+    static void StartBackgroundJob(backgroundJob_t Job);
+
+    /// @brief This function stops a background job before it has finished.
+    /// @param Job - A function pointer to the job.
+    static void StopBackgroundJob(backgroundJob_t Job);
+
+    /// @brief This function returns the number of unfinished background jobs.
+    /// @return Number of background jobs.
+    static std::size_t GetNumberOfBackgroundJobs(void);
+
+    /// @brief This function runs slices of the background jobs in round-robin order.
+    /// Slices are run until Config::backgroundCyclesPerIdle has been spent or tasks or events have become pending. A slice
+    /// itself is never interrupted by the scheduler, so it must be short compared to the task intervals.
+    /// @return True if any slice was run.
+    static bool RunBackgroundJobs(void);
+
     /// @brief This function is called from the main loop.
     static void MainLoop(void);
 
@@ -206,27 +458,253 @@ private:
     /// @param error - Type of error that occurred.
     static void ThrowError(SysError error);
 
+    /// @brief This is the kind of an event queue entry. It tells which members of the entry unions are in use.
+    enum class EntryKind : uint8_t
+    {
+        event = 0,      //!< An event with a payload pointer.
+        inlineEvent,    //!< An event with a payload copied into the entry.
+        message,        //!< A multicast message with a payload pointer.
+        pooledMessage   //!< A multicast message with a payload pool block.
+    };
+
+    /// @brief This is an event queue entry. A message is queued once as a multicast entry and delivered to all its listeners
+    /// when the entry is run. The members that are not used at the same time share storage, so a plain event takes only
+    /// the handler, the payload pointer and the kind.
+    struct eventEntry_t
+    {
+        union
+        {
+            eventHandler_t Handler; //!< A function pointer to the event handler of an event entry.
+            Message messageType;    //!< Message type of a message entry.
+        };
+        union
+        {
+            const void* pPayload;   //!< A pointer to the payload of an event or message entry.
+            payloadHandle_t payload;//!< Handle of the pooled payload that is released after the entry is run.
+            InlinePayloadStorage<Config::eventInlinePayloadSize> inlinePayload; //!< Payload of an inline event entry.
+        };
+        EntryKind kind;             //!< Kind of the entry.
+
+        /// @brief Compares two entries. The entries are equal if they are of the same kind and have the same handler or
+        /// message type and the same payload. Inline payloads are compared by content.
+        /// @param other - The entry to compare with.
+        /// @return True if the entries are equal.
+        bool operator==(eventEntry_t const& other) const
+        {
+            bool isEqual = (kind == other.kind);
+
+            if (isEqual == true)
+            {
+                switch (kind)
+                {
+                    case EntryKind::event:
+                        isEqual = (Handler == other.Handler) && (pPayload == other.pPayload);
+                        break;
+                    case EntryKind::inlineEvent:
+                        isEqual = (Handler == other.Handler) && (inlinePayload == other.inlinePayload);
+                        break;
+                    case EntryKind::message:
+                        isEqual = (messageType == other.messageType) && (pPayload == other.pPayload);
+                        break;
+                    default:
+                        isEqual = (messageType == other.messageType) && (payload == other.payload);
+                        break;
+                }
+            }
+            return isEqual;
+        }
+    };
+
+    /// @brief This function returns the payload pointer that is given to the handlers of an entry.
+    /// @param entry - A reference to the entry.
+    /// @return A pointer to the payload.
+    static const void* GetEntryPayload(eventEntry_t const& entry);
+
+    /// @brief This function releases the pooled payload reference of an entry, if it has one. Must be called with
+    /// interrupts disabled.
+    /// @param entry - A reference to the entry.
+    static void ReleaseEntryPayload(eventEntry_t const& entry);
+
+    /// @brief This function pushes an entry into the event queue.
+    /// @param entry - A reference to the entry to be pushed.
+    static void PushEntry(eventEntry_t const& entry);
+
+    /// @brief This function applies the event overflow policy to an entry that did not fit into the event queue.
+    /// Must be called with interrupts disabled.
+    /// @param entry - The entry that was pushed.
+    /// @param droppedEntry - A reference to the entry that was dropped, if any.
+    /// @return True if an entry was dropped.
+    static bool HandleEventOverflow(eventEntry_t const& entry, eventEntry_t& droppedEntry);
+
+    /// @brief This function releases a reference to a payload pool block. Must be called with interrupts disabled.
+    /// @param payload - Handle of the block.
+    static void ReleasePayloadReference(payloadHandle_t payload);
+
+    /// @brief This function checks if a message type has any listeners. Static routes are checked first by index.
+    /// @param type - The message type.
+    /// @return True if the message has listeners.
+    static bool HasMessageListeners(Message type);
+
+    /// @brief This function checks if a listener shall receive messages of the given type.
+    /// @param listener - A reference to the listener.
+    /// @param type - The message type.
+    /// @return True if the listener shall receive the message.
+    static bool IsListenerOf(messageListener_t const& listener, Message type);
+
+    /// @brief This function delivers a message to all the listeners of its type. The static route is delivered first.
+    /// @param type - The message type.
+    /// @param pPayload - A pointer to the message payload.
+    static void DispatchMessage(Message type, const void* pPayload);
+
+    /// @brief This function removes the listeners that have been unregistered during a dispatch.
+    static void RemoveUnregisteredListeners(void);
+
+    /// @brief This function returns the utilisation of a single task.
+    /// @param task - A reference to the task.
+    /// @param maxCycles - The longest measured run time of the task in CPU cycles.
+    /// @return Utilisation in parts per million.
+    static uint32_t GetTaskUtilisation(task_t const& task, uint32_t maxCycles);
+
+    /// @brief This function checks if a task can be created without exceeding the utilisation bound.
+    /// A task with the same handler is replaced by the new task in the test. A periodic task without a declared WCET is
+    /// not admissible.
+    /// @param task - A reference to the task.
+    /// @return True if the task is admissible.
+    static bool IsAdmissible(task_t const& task);
+
+    /// @brief This function returns the Liu-Layland utilisation bound n(2^(1/n) - 1) of a task set.
+    /// @param numberOfTasks - Number of periodic tasks in the set.
+    /// @return Bound in parts per million.
+    static uint32_t GetUtilisationBound(std::size_t numberOfTasks);
+
+    /// @brief This function returns the interval of a task taking the overload into account.
+    /// @param taskId - Task ID
+    /// @return Interval in milliseconds.
+    static uint16_t GetEffectiveInterval(taskId_t taskId);
+
+    /// @brief This function evaluates the load of the elapsed measurement window and enters or leaves the overload.
+    static void EvaluateLoad(void);
+
+    /// @brief This function replaces the task set with the task set of the pending schedule mode and counts the ticks
+    /// elapsed since the switch against it. Called in the main loop with interrupts disabled, so the due preemptive
+    /// tasks are only counted and the caller posts them to their levels.
+    /// @param levelActivations - Number of due activations of each preemptive task of the new set. Zeroed by the caller.
+    static void ApplyScheduleMode(uint16_t levelActivations[]);
+
+    /// @brief This function advances the counter of a task by one tick and activates the task when it is due.
+    /// A due preemptive task is not posted to its level here.
+    /// @param taskId - Task ID
+    /// @return True if a preemptive task is due and must be posted to its level.
+    static bool CountDownTask(taskId_t taskId);
+
+    /// @brief This function returns the ID of a task.
+    /// @param Task - A function pointer to the task.
+    /// @return Task ID, or taskCount if the task does not exist.
+    static taskId_t GetTaskId(taskHandler_t Task);
+
+    /// @brief This function marks the links of a completed task done and releases the successors whose all links are done.
+    /// @param Predecessor - A function pointer to the completed task.
+    /// @return True if any successor was released.
+    static bool ReleaseSuccessors(taskHandler_t Predecessor);
+
+    /// @brief This function checks if a task can be reached from another task through the task links.
+    /// @param From - A function pointer to the start task.
+    /// @param To - A function pointer to the searched task.
+    /// @return True if the task is reachable.
+    static bool IsTaskReachable(taskHandler_t From, taskHandler_t To);
+
+    /// @brief This function removes all the links of a task.
+    /// @param Task - A function pointer to the task.
+    static void RemoveTaskLinks(taskHandler_t Task);
+
+    /// @brief This function calls an event or message handler between the event hooks of the configuration.
+    /// @param Handler - A function pointer to the handler.
+    /// @param pPayload - A pointer to the payload.
+    static void CallEventHandler(eventHandler_t Handler, const void* pPayload);
+
+    /// @brief This function checks if the budget of the current event pass has been spent.
+    /// @param eventsInPass - Number of events run in the current pass.
+    /// @param passStartCycles - CPU cycle count at the start of the current pass.
+    /// @return True if the budget has been spent.
+    static bool IsEventPassSpent(std::size_t eventsInPass, uint32_t passStartCycles);
+
     /// @brief This is a struct that is used to keep track of task states.
     typedef struct
     {
         uint16_t msCounter;
         bool isRunning;
+        uint32_t maxCycles; //!< The longest measured run time in CPU cycles.
     } taskState_t;
 
     static taskState_t taskStates[Config::schedulerTasksMax]; //!< Task states.
     static volatile bool runTasks;  //!< An indication to run the tasks.
     static volatile bool runEvents; //!< An indication to run the events.
-    static uint8_t msPerTick;       //!< How many ms is one tick.
+    static uint16_t msPerTick;      //!< How many ms is one tick.
 
     static SchedulerStatus status;  //!< Current scheduler status
     
-    static uint8_t taskCount;                       //!< Current task count.
+    static bool isElasticModeEnabled;           //!< An indication that the elastic mode is enabled.
+    static bool isOverloaded;                   //!< An indication of overload.
+    static uint16_t loadWindowMs;               //!< Elapsed time of the current load measurement window.
+    static volatile bool isLoadWindowElapsed;   //!< An indication to evaluate the load of the window.
+    static uint32_t busyCycles;                 //!< CPU cycles spent in tasks and events in the current window.
+    static uint32_t load;                       //!< Load of the previous window in parts per million.
+    static volatile uint32_t deadlineMissCount; //!< Total number of deadline misses.
+    static volatile uint8_t windowDeadlineMisses;   //!< Number of deadline misses in the current window.
+
+    static ScheduleMode scheduleMode;                   //!< Active schedule mode.
+    static volatile ScheduleMode pendingScheduleMode;   //!< Schedule mode applied at the next tick. Invalid if none.
+    static volatile bool isPendingPhasePreserved;       //!< An indication to preserve the task phases in the pending switch.
+    static volatile uint16_t modeSwitchTicks;           //!< Ticks elapsed since the pending switch was due. Zero if none.
+
+    static AdmissionPolicy admissionPolicy;         //!< Policy applied to tasks that fail the schedulability test.
+    static taskId_t taskCount;                      //!< Current task count.
     static task_t tasks[Config::schedulerTasksMax]; //!< List of tasks limited by configuration variable schedulerTasksMax
 
-    static Utils::Queue<event_t, Config::schedulerEventsMax> eventQueue;    //!< Event queue.
+    /// @brief This is a task dependency link.
+    typedef struct
+    {
+        taskHandler_t Predecessor;  //!< A function pointer to the predecessor task.
+        taskHandler_t Successor;    //!< A function pointer to the successor task.
+        bool isDone;                //!< An indication that the predecessor has completed since the successor was released.
+    } taskLink_t;
+
+    typedef Utils::IndexType<Config::schedulerTaskLinksMax>::type taskLinkIndex_t;  //!< A task link index and count type.
+
+    static taskLinkIndex_t taskLinkCount;                       //!< Current task link count.
+    static taskLink_t taskLinks[Config::schedulerTaskLinksMax]; //!< List of task dependency links.
+
+    static Utils::Queue<eventEntry_t, Config::schedulerEventsMax> eventQueue;   //!< Event queue.
+    static EventOverflowPolicy eventOverflowPolicy;     //!< Policy applied to event queue overflows.
+    static eventOverflowHandler_t EventOverflowHandler; //!< Optional handler notified of dropped events.
+    static uint32_t droppedEventCount;                  //!< Number of events dropped due to event queue overflow.
+    static bool isEventCoalescingEnabled;   //!< An indication to merge pushed events into equal pending events.
+    static uint32_t coalescedEventCount;    //!< Number of merged event pushes.
+
+    /// @brief This is a message payload pool block.
+    typedef struct
+    {
+        uint64_t data[(Config::payloadBlockSize + 7U) / 8U];    //!< Payload data.
+    } payloadBlock_t;
+
+    /// @brief This is the message payload pool. It is not locked itself, since the reference counts are updated in the
+    /// same critical sections.
+    typedef Utils::Pool<payloadBlock_t, Config::payloadBlocksMax, Utils::NoLock, true> payloadPool_t;
+
+    static payloadPool_t payloadPool;                               //!< Payload pool.
+    static uint8_t payloadReferences[Config::payloadBlocksMax];     //!< Reference counts of the payload pool blocks.
+
+    static backgroundJob_t backgroundJobs[Config::backgroundJobsMax];   //!< List of unfinished background jobs.
+    typedef Utils::IndexType<Config::backgroundJobsMax>::type backgroundJobIndex_t;  //!< A background job index and count type.
+
+    static backgroundJobIndex_t backgroundJobCount;                     //!< Current background job count.
+    static backgroundJobIndex_t nextBackgroundJob;                      //!< Index of the job that runs the next slice.
+
+    typedef Utils::IndexType<Config::messageListenersMax>::type listenerIndex_t;  //!< A message listener index and count type.
 
-    static uint8_t messageListenerCount;                            //!< Current message listener total count.
+    static listenerIndex_t messageListenerCount;                    //!< Current message listener total count.
     static messageListener_t messageListeners[Config::messageListenersMax]; //!< List of message listeners limited by a configuration variable messageListenersMax.
+    static bool isDispatchingMessage;                               //!< An indication that the listeners are being called.
 };
 
 } // namespace ASch
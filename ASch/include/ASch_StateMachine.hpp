@@ -0,0 +1,238 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_StateMachine.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   StateMachine
+//! @brief   This is the hierarchical state machine engine of ASch.
+//! 
+//! A state machine is described with two constant tables: a state table that gives the parent, the entry and exit
+//! actions and the default substate of each state, and a transition table that is sorted by source state and signal.
+//! The engine looks the transitions up from the sorted table and runs the exit and entry action chains between the
+//! source and the target state. The machines are driven by ASch events and messages through StateMachine::Handler.
+
+#ifndef ASCH_STATEMACHINE_HPP_
+#define ASCH_STATEMACHINE_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <ASch_System.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+typedef uint8_t stateId_t;      //!< A state ID type. The ID is the index of the state in the state table.
+typedef uint16_t hsmSignal_t;   //!< A state machine signal type.
+
+typedef void (*hsmAction_t)(const void* pPayload);  //!< A function pointer type for entry, exit and transition actions.
+typedef bool (*hsmGuard_t)(const void* pPayload);   //!< A function pointer type for transition guards.
+
+const stateId_t noState = 0xFFU;    //!< An ID that refers to no state.
+const std::size_t hsmDepthMax = 8U; //!< Maximum nesting depth of states.
+
+/// @brief This is a state table entry.
+typedef struct
+{
+    stateId_t parent;   //!< Parent state, or noState for top level states.
+    stateId_t initial;  //!< Default substate that is entered after this state, or noState for leaf states.
+    hsmAction_t Entry;  //!< Entry action, or zero.
+    hsmAction_t Exit;   //!< Exit action, or zero.
+} hsmState_t;
+
+/// @brief This is a transition table entry. The table must be sorted by source state and signal.
+/// Several entries with the same source and signal are tried in table order until a guard passes.
+typedef struct
+{
+    stateId_t source;   //!< State that handles the signal. The signal is also handled in the substates of the state.
+    hsmSignal_t signal; //!< Signal that triggers the transition.
+    stateId_t target;   //!< Target state, or noState for an internal transition that runs only the action.
+    hsmGuard_t Guard;   //!< Guard condition, or zero for an unconditional transition.
+    hsmAction_t Action; //!< Transition action, or zero.
+} hsmTransition_t;
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//! @class   StateMachine
+//! @brief   This class runs a hierarchical state machine described with constant tables.
+//! A signal is looked up first in the transitions of the current state and then in the transitions of its ancestors.
+//! Transitions into a substate of the source are local, i.e. the source state is not exited. The tables should be
+//! declared constexpr and checked with IsSorted() and HasValidParents() in static assertions.
+class StateMachine
+{
+public:
+    /// @brief Constructor. The machine is not started until Start() is called.
+    /// @param states - A reference to the state table.
+    /// @param transitions - A reference to the transition table.
+    template <std::size_t numberOfStates, std::size_t numberOfTransitions>
+    StateMachine(const hsmState_t (&states)[numberOfStates], const hsmTransition_t (&transitions)[numberOfTransitions]) :
+        pStates(states),
+        stateCount(numberOfStates),
+        pTransitions(transitions),
+        transitionCount(numberOfTransitions),
+        currentState(noState)
+    {
+        static_assert(numberOfStates < noState, "Too many states for the state ID type.");
+    };
+
+    /// @brief This function starts the machine. The entry actions are run from the top level state down to the given
+    /// state and its default substates.
+    /// @param initialState - The state to be entered.
+    void Start(stateId_t initialState);
+
+    /// @brief This function dispatches a signal to the machine. The transition is run to completion.
+    /// @param signal - The signal.
+    /// @param pPayload - A pointer to the optional payload that is passed to the guards and the actions.
+    /// @return True if the signal was handled.
+    bool Dispatch(hsmSignal_t signal, const void* pPayload);
+
+    /// @brief This function returns the current leaf state.
+    /// @return Current state, or noState if the machine is not started.
+    stateId_t GetState(void) const;
+
+    /// @brief This function checks if the machine is in the given state or in any of its substates.
+    /// @param state - The state.
+    /// @return True if the machine is in the state.
+    bool IsIn(stateId_t state) const;
+
+    /// @brief This is an event and message handler that dispatches a signal to a machine.
+    /// It can be used directly as an eventHandler_t, a messageHandler_t or in Config::messageRoutes.
+    /// @param pPayload - A pointer to the event payload.
+    template <StateMachine& machine, hsmSignal_t signal>
+    static void Handler(const void* pPayload)
+    {
+        (void)machine.Dispatch(signal, pPayload);
+        return;
+    }
+
+    /// @brief This function checks at compile time that a transition table is sorted by source state and signal.
+    /// @param transitions - A reference to the transition table.
+    /// @return True if the table is sorted.
+    template <std::size_t numberOfTransitions>
+    static constexpr bool IsSorted(const hsmTransition_t (&transitions)[numberOfTransitions])
+    {
+        return IsSorted(transitions, numberOfTransitions);
+    }
+
+    /// @brief This function checks at compile time that every parent state precedes its substates in a state table and
+    /// that every default substate is a direct substate of its state. This guarantees that the hierarchy and the default
+    /// substate chains have no loops, and that the entry actions of all the entered states are run.
+    /// @param states - A reference to the state table.
+    /// @return True if the parents are valid.
+    template <std::size_t numberOfStates>
+    static constexpr bool HasValidParents(const hsmState_t (&states)[numberOfStates])
+    {
+        return HasValidParents(states, 0U, numberOfStates);
+    }
+
+private:
+    /// @brief This function returns the sort key of a transition.
+    static constexpr uint32_t GetKey(stateId_t source, hsmSignal_t signal)
+    {
+        return (static_cast<uint32_t>(source) << 16U) | static_cast<uint32_t>(signal);
+    }
+
+    /// @brief This function checks recursively that a transition table is sorted.
+    static constexpr bool IsSorted(const hsmTransition_t* pTransitions, std::size_t count)
+    {
+        return (count < 2U) ||
+               ((GetKey(pTransitions[0].source, pTransitions[0].signal) <= GetKey(pTransitions[1].source, pTransitions[1].signal)) &&
+                IsSorted(&pTransitions[1], count - 1U));
+    }
+
+    /// @brief This function checks recursively that the parent states precede their substates and that the default
+    /// substates are direct substates.
+    static constexpr bool HasValidParents(const hsmState_t* pStates, std::size_t index, std::size_t count)
+    {
+        return (index >= count) ||
+               (((pStates[index].parent == noState) || (pStates[index].parent < index)) &&
+                ((pStates[index].initial == noState) ||
+                 ((pStates[index].initial < count) && (pStates[pStates[index].initial].parent == index))) &&
+                HasValidParents(pStates, index + 1U, count));
+    }
+
+    /// @brief This function finds the transition that handles a signal in a state.
+    /// @param state - The state.
+    /// @param signal - The signal.
+    /// @param pPayload - A pointer to the payload for the guards.
+    /// @return A pointer to the transition, or zero if the state does not handle the signal.
+    const hsmTransition_t* FindTransition(stateId_t state, hsmSignal_t signal, const void* pPayload) const;
+
+    /// @brief This function runs a transition.
+    /// @param source - The state that handled the signal.
+    /// @param transition - A reference to the transition.
+    /// @param pPayload - A pointer to the payload for the actions.
+    void Transit(stateId_t source, hsmTransition_t const& transition, const void* pPayload);
+
+    /// @brief This function finds the state below which an external transition is run.
+    /// @param source - The source state.
+    /// @param target - The target state.
+    /// @return The lowest common ancestor that is not exited, or noState for top level.
+    stateId_t FindCommonAncestor(stateId_t source, stateId_t target) const;
+
+    /// @brief This function returns the nesting depth of a state.
+    /// @param state - The state.
+    /// @return Depth. Top level states have depth one.
+    std::size_t GetDepth(stateId_t state) const;
+
+    /// @brief This function exits the states from the current state up to the given ancestor.
+    /// @param ancestor - The ancestor that is not exited.
+    /// @param pPayload - A pointer to the payload for the actions.
+    void ExitTo(stateId_t ancestor, const void* pPayload);
+
+    /// @brief This function enters the states from below the given ancestor down to the target and its default
+    /// substates.
+    /// @param ancestor - The ancestor that is already active.
+    /// @param target - The target state.
+    /// @param pPayload - A pointer to the payload for the actions.
+    void EnterFrom(stateId_t ancestor, stateId_t target, const void* pPayload);
+
+    const hsmState_t* const pStates;            //!< A pointer to the state table.
+    const std::size_t stateCount;               //!< Number of states.
+    const hsmTransition_t* const pTransitions;  //!< A pointer to the transition table.
+    const std::size_t transitionCount;          //!< Number of transitions.
+    stateId_t currentState;                     //!< Current leaf state.
+};
+
+} // namespace ASch
+
+#endif // ASCH_STATEMACHINE_HPP_
@@ -87,6 +87,7 @@ public:
     static void EnableResetOnSystemError(void);
 
     /// @brief This fuction initialises the system, e.f. clocks and other base peripherals.
+    /// The scheduler, the active objects and the preemption levels are initialised as well.
     static void Init(void);
 
     /// @brief This function runs pre-start configuration functions.
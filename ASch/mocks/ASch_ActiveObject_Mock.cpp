@@ -0,0 +1,107 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_ActiveObject_Mock.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @brief   Mocks for ASch ActiveObject.
+//! 
+//! These are mocks for ASch ActiveObject utilising FakeIt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_ActiveObject_Mock.hpp>
+#include <ASch_ActiveObject.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Mock Initialisation
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASchMock
+{
+
+Mock<ActiveObject> mockASchActiveObject;
+static ASchMock::ActiveObject& activeObject = mockASchActiveObject.get();
+
+void InitActiveObject(void)
+{
+    static bool isFirstInit = true;
+
+    if (isFirstInit == true)
+    {
+        Fake(Method(mockASchActiveObject, Init));
+        Fake(Method(mockASchActiveObject, Create));
+        Fake(Method(mockASchActiveObject, Post));
+        Fake(Method(mockASchActiveObject, GetNumberOfEvents));
+        Fake(Method(mockASchActiveObject, GetDroppedEventCount));
+        Fake(Method(mockASchActiveObject, Run));
+
+        isFirstInit = false;
+    }
+    else
+    {
+        mockASchActiveObject.ClearInvocationHistory();
+    }
+    return;
+}
+
+} // namespace ASchMock
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Mock Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+void ActiveObject::Init(void)
+{
+    ASchMock::activeObject.Init();
+    return;
+}
+
+activeObjectId_t ActiveObject::Create(aoDispatcher_t Dispatch, uint8_t priority, aoEvent_t* pQueue, std::size_t queueSize)
+{
+    return ASchMock::activeObject.Create(Dispatch, priority, pQueue, queueSize);
+}
+
+bool ActiveObject::Post(activeObjectId_t object, aoEvent_t const& event)
+{
+    return ASchMock::activeObject.Post(object, event);
+}
+
+std::size_t ActiveObject::GetNumberOfEvents(activeObjectId_t object)
+{
+    return ASchMock::activeObject.GetNumberOfEvents(object);
+}
+
+uint32_t ActiveObject::GetDroppedEventCount(activeObjectId_t object)
+{
+    return ASchMock::activeObject.GetDroppedEventCount(object);
+}
+
+bool ActiveObject::Run(void)
+{
+    return ASchMock::activeObject.Run();
+}
+
+} // namespace ASch
@@ -0,0 +1,107 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Arena_Mock.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @brief   Mocks for ASch Arena.
+//! 
+//! These are mocks for ASch Arena utilising FakeIt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_Arena_Mock.hpp>
+#include <ASch_Arena.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Mock Initialisation
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASchMock
+{
+
+Mock<Arena> mockASchArena;
+static ASchMock::Arena& arena = mockASchArena.get();
+
+void InitArena(void)
+{
+    static bool isFirstInit = true;
+
+    if (isFirstInit == true)
+    {
+        Fake(Method(mockASchArena, Allocate));
+        Fake(Method(mockASchArena, Seal));
+        Fake(Method(mockASchArena, IsSealed));
+        Fake(Method(mockASchArena, GetUsage));
+        Fake(Method(mockASchArena, GetTotalUsage));
+        Fake(Method(mockASchArena, GetFree));
+
+        isFirstInit = false;
+    }
+    else
+    {
+        mockASchArena.ClearInvocationHistory();
+    }
+    return;
+}
+
+} // namespace ASchMock
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Mock Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+void* Arena::Allocate(ArenaOwner owner, std::size_t size, std::size_t alignment)
+{
+    return ASchMock::arena.Allocate(owner, size, alignment);
+}
+
+void Arena::Seal(void)
+{
+    ASchMock::arena.Seal();
+    return;
+}
+
+bool Arena::IsSealed(void)
+{
+    return ASchMock::arena.IsSealed();
+}
+
+std::size_t Arena::GetUsage(ArenaOwner owner)
+{
+    return ASchMock::arena.GetUsage(owner);
+}
+
+std::size_t Arena::GetTotalUsage(void)
+{
+    return ASchMock::arena.GetTotalUsage();
+}
+
+std::size_t Arena::GetFree(void)
+{
+    return ASchMock::arena.GetFree();
+}
+
+} // namespace ASch
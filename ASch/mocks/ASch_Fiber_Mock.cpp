@@ -0,0 +1,122 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Fiber_Mock.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @brief   Mocks for ASch Fiber.
+//! 
+//! These are mocks for ASch Fiber utilising FakeIt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_Fiber_Mock.hpp>
+#include <ASch_Fiber.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Mock Initialisation
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASchMock
+{
+
+Mock<Fiber> mockASchFiber;
+static ASchMock::Fiber& fiber = mockASchFiber.get();
+
+void InitFiber(void)
+{
+    static bool isFirstInit = true;
+
+    if (isFirstInit == true)
+    {
+        Fake(Method(mockASchFiber, Init));
+        Fake(Method(mockASchFiber, Create));
+        Fake(Method(mockASchFiber, Delay));
+        Fake(Method(mockASchFiber, Wait));
+        Fake(Method(mockASchFiber, Signal));
+        Fake(Method(mockASchFiber, GetCurrent));
+        Fake(Method(mockASchFiber, Run));
+        Fake(Method(mockASchFiber, Tick));
+
+        isFirstInit = false;
+    }
+    else
+    {
+        mockASchFiber.ClearInvocationHistory();
+    }
+    return;
+}
+
+} // namespace ASchMock
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Mock Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+void Fiber::Init(void)
+{
+    ASchMock::fiber.Init();
+    return;
+}
+
+fiberId_t Fiber::Create(fiberHandler_t Handler)
+{
+    return ASchMock::fiber.Create(Handler);
+}
+
+void Fiber::Delay(uint32_t delayInMs)
+{
+    ASchMock::fiber.Delay(delayInMs);
+    return;
+}
+
+uint32_t Fiber::Wait(uint32_t events)
+{
+    return ASchMock::fiber.Wait(events);
+}
+
+void Fiber::Signal(fiberId_t fiber, uint32_t events)
+{
+    ASchMock::fiber.Signal(fiber, events);
+    return;
+}
+
+fiberId_t Fiber::GetCurrent(void)
+{
+    return ASchMock::fiber.GetCurrent();
+}
+
+bool Fiber::Run(void)
+{
+    return ASchMock::fiber.Run();
+}
+
+void Fiber::Tick(uint32_t elapsedInMs)
+{
+    ASchMock::fiber.Tick(elapsedInMs);
+    return;
+}
+
+} // namespace ASch
@@ -0,0 +1,97 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Preemption_Mock.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @brief   Mocks for ASch Preemption.
+//! 
+//! These are mocks for ASch Preemption utilising FakeIt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_Preemption_Mock.hpp>
+#include <ASch_Preemption.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Mock Initialisation
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASchMock
+{
+
+Mock<Preemption> mockASchPreemption;
+static ASchMock::Preemption& preemption = mockASchPreemption.get();
+
+void InitPreemption(void)
+{
+    static bool isFirstInit = true;
+
+    if (isFirstInit == true)
+    {
+        Fake(Method(mockASchPreemption, Init));
+        Fake(Method(mockASchPreemption, PostEvent));
+        Fake(Method(mockASchPreemption, PostTask));
+        Fake(Method(mockASchPreemption, GetCurrentLevel));
+
+        isFirstInit = false;
+    }
+    else
+    {
+        mockASchPreemption.ClearInvocationHistory();
+    }
+    return;
+}
+
+} // namespace ASchMock
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Mock Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+void Preemption::Init(void)
+{
+    ASchMock::preemption.Init();
+    return;
+}
+
+void Preemption::PostEvent(uint8_t level, event_t const& event)
+{
+    ASchMock::preemption.PostEvent(level, event);
+    return;
+}
+
+void Preemption::PostTask(uint8_t level, taskHandler_t Task)
+{
+    ASchMock::preemption.PostTask(level, Task);
+    return;
+}
+
+uint8_t Preemption::GetCurrentLevel(void)
+{
+    return ASchMock::preemption.GetCurrentLevel();
+}
+
+} // namespace ASch
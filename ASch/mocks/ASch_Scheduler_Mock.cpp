@@ -54,22 +54,53 @@ void InitScheduler(void)
         Fake(Method(mockASchScheduler, GetStatus));
         Fake(Method(mockASchScheduler, GetTaskCount));
         Fake(Method(mockASchScheduler, CreateTask));
+        Fake(Method(mockASchScheduler, LinkTasks));
         Fake(Method(mockASchScheduler, DeleteTask));
         Fake(Method(mockASchScheduler, GetTaskInterval));
+        Fake(Method(mockASchScheduler, SetAdmissionPolicy));
+        Fake(Method(mockASchScheduler, GetTaskWcet));
+        Fake(Method(mockASchScheduler, GetUtilisation));
+        Fake(Method(mockASchScheduler, IsSchedulable));
+        Fake(Method(mockASchScheduler, SetElasticMode));
+        Fake(Method(mockASchScheduler, IsOverloaded));
+        Fake(Method(mockASchScheduler, GetLoad));
+        Fake(Method(mockASchScheduler, GetDeadlineMissCount));
+        Fake(Method(mockASchScheduler, SwitchMode));
+        Fake(Method(mockASchScheduler, GetScheduleMode));
         Fake(Method(mockASchScheduler, RunTasks));
         Fake(Method(mockASchScheduler, Sleep));
         Fake(Method(mockASchScheduler, WakeUp));
         Fake(Method(mockASchScheduler, PushEvent));
+        Fake(Method(mockASchScheduler, PushInlineEvent));
+        Fake(Method(mockASchScheduler, SetEventOverflowPolicy));
+        Fake(Method(mockASchScheduler, SetEventOverflowHandler));
+        Fake(Method(mockASchScheduler, GetDroppedEventCount));
+        Fake(Method(mockASchScheduler, SetEventCoalescing));
+        Fake(Method(mockASchScheduler, GetCoalescedEventCount));
         Fake(Method(mockASchScheduler, RunEvents));
         Fake(Method(mockASchScheduler, RegisterMessageListener));
         Fake(Method(mockASchScheduler, UnregisterMessageListener));
         Fake(Method(mockASchScheduler, GetNumberOfMessageListeners));
         Fake(Method(mockASchScheduler, PushMessage));
+        Fake(Method(mockASchScheduler, AllocatePayload));
+        Fake(Method(mockASchScheduler, GetPayload));
+        Fake(Method(mockASchScheduler, RetainPayload));
+        Fake(Method(mockASchScheduler, ReleasePayload));
+        Fake(Method(mockASchScheduler, GetNumberOfFreePayloads));
+        Fake(Method(mockASchScheduler, GetPayloadHighWaterMark));
+        Fake(Method(mockASchScheduler, GetPayloadAllocationFailureCount));
+        Fake(Method(mockASchScheduler, PushPooledMessage));
+        Fake(Method(mockASchScheduler, StartBackgroundJob));
+        Fake(Method(mockASchScheduler, StopBackgroundJob));
+        Fake(Method(mockASchScheduler, GetNumberOfBackgroundJobs));
+        Fake(Method(mockASchScheduler, RunBackgroundJobs));
         Fake(Method(mockASchScheduler, MainLoop));
+
+        isFirstInit = false;
     }
     else
     {
-        mockASchScheduler.Reset();
+        mockASchScheduler.ClearInvocationHistory();
     }
     return;
 }
@@ -106,14 +137,19 @@ SchedulerStatus Scheduler::GetStatus(void)
     return ASchMock::scheduler.GetStatus();
 }
 
-uint8_t Scheduler::GetTaskCount(void)
+taskId_t Scheduler::GetTaskCount(void)
 {
     return ASchMock::scheduler.GetTaskCount();
 }
 
-void Scheduler::CreateTask(task_t task)
+bool Scheduler::CreateTask(task_t task)
+{
+    return ASchMock::scheduler.CreateTask(task);
+}
+
+void Scheduler::LinkTasks(taskHandler_t Predecessor, taskHandler_t Successor)
 {
-    ASchMock::scheduler.CreateTask(task);
+    ASchMock::scheduler.LinkTasks(Predecessor, Successor);
     return;
 }
 
@@ -123,11 +159,64 @@ void Scheduler::DeleteTask(taskHandler_t taskHandler)
     return;
 }
 
-uint16_t Scheduler::GetTaskInterval(uint8_t taskId)
+uint16_t Scheduler::GetTaskInterval(taskId_t taskId)
 {
     return ASchMock::scheduler.GetTaskInterval(taskId);
 }
 
+void Scheduler::SetAdmissionPolicy(AdmissionPolicy policy)
+{
+    ASchMock::scheduler.SetAdmissionPolicy(policy);
+    return;
+}
+
+uint32_t Scheduler::GetTaskWcet(taskId_t taskId)
+{
+    return ASchMock::scheduler.GetTaskWcet(taskId);
+}
+
+uint32_t Scheduler::GetUtilisation(void)
+{
+    return ASchMock::scheduler.GetUtilisation();
+}
+
+bool Scheduler::IsSchedulable(void)
+{
+    return ASchMock::scheduler.IsSchedulable();
+}
+
+void Scheduler::SetElasticMode(bool isEnabled)
+{
+    ASchMock::scheduler.SetElasticMode(isEnabled);
+    return;
+}
+
+bool Scheduler::IsOverloaded(void)
+{
+    return ASchMock::scheduler.IsOverloaded();
+}
+
+uint32_t Scheduler::GetLoad(void)
+{
+    return ASchMock::scheduler.GetLoad();
+}
+
+uint32_t Scheduler::GetDeadlineMissCount(void)
+{
+    return ASchMock::scheduler.GetDeadlineMissCount();
+}
+
+void Scheduler::SwitchMode(ScheduleMode mode, bool isPhasePreserved)
+{
+    ASchMock::scheduler.SwitchMode(mode, isPhasePreserved);
+    return;
+}
+
+ScheduleMode Scheduler::GetScheduleMode(void)
+{
+    return ASchMock::scheduler.GetScheduleMode();
+}
+
 void Scheduler::RunTasks(void)
 {
     ASchMock::scheduler.RunTasks();
@@ -152,6 +241,40 @@ void Scheduler::PushEvent(event_t const& event)
     return;
 }
 
+void Scheduler::PushInlineEvent(eventHandler_t Handler, const void* pData, std::size_t size)
+{
+    ASchMock::scheduler.PushInlineEvent(Handler, pData, size);
+    return;
+}
+
+void Scheduler::SetEventOverflowPolicy(EventOverflowPolicy policy)
+{
+    ASchMock::scheduler.SetEventOverflowPolicy(policy);
+    return;
+}
+
+void Scheduler::SetEventOverflowHandler(eventOverflowHandler_t Handler)
+{
+    ASchMock::scheduler.SetEventOverflowHandler(Handler);
+    return;
+}
+
+uint32_t Scheduler::GetDroppedEventCount(void)
+{
+    return ASchMock::scheduler.GetDroppedEventCount();
+}
+
+void Scheduler::SetEventCoalescing(bool isEnabled)
+{
+    ASchMock::scheduler.SetEventCoalescing(isEnabled);
+    return;
+}
+
+uint32_t Scheduler::GetCoalescedEventCount(void)
+{
+    return ASchMock::scheduler.GetCoalescedEventCount();
+}
+
 void Scheduler::RunEvents(void)
 {
     ASchMock::scheduler.RunEvents();
@@ -170,7 +293,7 @@ void Scheduler::UnregisterMessageListener(messageListener_t const& listener)
     return;
 }
 
-uint8_t Scheduler::GetNumberOfMessageListeners(Message type)
+std::size_t Scheduler::GetNumberOfMessageListeners(Message type)
 {
     return ASchMock::scheduler.GetNumberOfMessageListeners(type);
 }
@@ -181,6 +304,71 @@ void Scheduler::PushMessage(message_t const& message)
     return;
 }
 
+payloadHandle_t Scheduler::AllocatePayload(void)
+{
+    return ASchMock::scheduler.AllocatePayload();
+}
+
+void* Scheduler::GetPayload(payloadHandle_t payload)
+{
+    return ASchMock::scheduler.GetPayload(payload);
+}
+
+void Scheduler::RetainPayload(payloadHandle_t payload)
+{
+    ASchMock::scheduler.RetainPayload(payload);
+    return;
+}
+
+void Scheduler::ReleasePayload(payloadHandle_t payload)
+{
+    ASchMock::scheduler.ReleasePayload(payload);
+    return;
+}
+
+std::size_t Scheduler::GetNumberOfFreePayloads(void)
+{
+    return ASchMock::scheduler.GetNumberOfFreePayloads();
+}
+
+std::size_t Scheduler::GetPayloadHighWaterMark(void)
+{
+    return ASchMock::scheduler.GetPayloadHighWaterMark();
+}
+
+uint32_t Scheduler::GetPayloadAllocationFailureCount(void)
+{
+    return ASchMock::scheduler.GetPayloadAllocationFailureCount();
+}
+
+void Scheduler::PushPooledMessage(Message type, payloadHandle_t payload)
+{
+    ASchMock::scheduler.PushPooledMessage(type, payload);
+    return;
+}
+
+void Scheduler::StartBackgroundJob(backgroundJob_t Job)
+{
+    ASchMock::scheduler.StartBackgroundJob(Job);
+    return;
+}
+
+void Scheduler::StopBackgroundJob(backgroundJob_t Job)
+{
+    ASchMock::scheduler.StopBackgroundJob(Job);
+    return;
+}
+
+std::size_t Scheduler::GetNumberOfBackgroundJobs(void)
+{
+    return ASchMock::scheduler.GetNumberOfBackgroundJobs();
+}
+
+bool Scheduler::RunBackgroundJobs(void)
+{
+    return ASchMock::scheduler.RunBackgroundJobs();
+}
+
 void Scheduler::MainLoop(void)
 {
     ASchMock::scheduler.MainLoop();
@@ -55,19 +55,48 @@ public:
     virtual void Start(void);
     virtual void Stop(void);
     virtual ASch::SchedulerStatus GetStatus(void);
-    virtual uint8_t GetTaskCount(void);
-    virtual void CreateTask(ASch::task_t task);
+    virtual ASch::taskId_t GetTaskCount(void);
+    virtual bool CreateTask(ASch::task_t task);
+    virtual void LinkTasks(ASch::taskHandler_t Predecessor, ASch::taskHandler_t Successor);
     virtual void DeleteTask(ASch::taskHandler_t taskHandler);
-    virtual uint16_t GetTaskInterval(uint8_t taskId);
+    virtual uint16_t GetTaskInterval(ASch::taskId_t taskId);
+    virtual void SetAdmissionPolicy(ASch::AdmissionPolicy policy);
+    virtual uint32_t GetTaskWcet(ASch::taskId_t taskId);
+    virtual uint32_t GetUtilisation(void);
+    virtual bool IsSchedulable(void);
+    virtual void SetElasticMode(bool isEnabled);
+    virtual bool IsOverloaded(void);
+    virtual uint32_t GetLoad(void);
+    virtual uint32_t GetDeadlineMissCount(void);
+    virtual void SwitchMode(ASch::ScheduleMode mode, bool isPhasePreserved);
+    virtual ASch::ScheduleMode GetScheduleMode(void);
     virtual void RunTasks(void);
     virtual void Sleep(void);
     virtual void WakeUp(void);
     virtual void PushEvent(ASch::event_t const& event);
+    virtual void PushInlineEvent(ASch::eventHandler_t Handler, const void* pData, std::size_t size);
+    virtual void SetEventOverflowPolicy(ASch::EventOverflowPolicy policy);
+    virtual void SetEventOverflowHandler(ASch::eventOverflowHandler_t Handler);
+    virtual uint32_t GetDroppedEventCount(void);
+    virtual void SetEventCoalescing(bool isEnabled);
+    virtual uint32_t GetCoalescedEventCount(void);
     virtual void RunEvents(void);
     virtual void RegisterMessageListener(ASch::messageListener_t const& listener);
     virtual void UnregisterMessageListener(ASch::messageListener_t const& listener);
-    virtual uint8_t GetNumberOfMessageListeners(ASch::Message type);
+    virtual std::size_t GetNumberOfMessageListeners(ASch::Message type);
     virtual void PushMessage(ASch::message_t const& message);
+    virtual ASch::payloadHandle_t AllocatePayload(void);
+    virtual void* GetPayload(ASch::payloadHandle_t payload);
+    virtual void RetainPayload(ASch::payloadHandle_t payload);
+    virtual void ReleasePayload(ASch::payloadHandle_t payload);
+    virtual std::size_t GetNumberOfFreePayloads(void);
+    virtual std::size_t GetPayloadHighWaterMark(void);
+    virtual uint32_t GetPayloadAllocationFailureCount(void);
+    virtual void PushPooledMessage(ASch::Message type, ASch::payloadHandle_t payload);
+    virtual void StartBackgroundJob(ASch::backgroundJob_t Job);
+    virtual void StopBackgroundJob(ASch::backgroundJob_t Job);
+    virtual std::size_t GetNumberOfBackgroundJobs(void);
+    virtual bool RunBackgroundJobs(void);
     virtual void MainLoop(void);
 };
 
@@ -0,0 +1,248 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_ActiveObject.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   ActiveObject
+//! @brief   This is the active object module of ASch.
+//! 
+//! The priorities that have queued events are kept in a bitmask, so the highest priority ready object is found with a
+//! single count leading zeros instruction regardless of the number of objects.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_ActiveObject.hpp>
+#include <Utils_Bit.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Local Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 6. Class Member Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//---------------------------------------
+// Initialise static members
+//---------------------------------------
+ActiveObject::activeObject_t ActiveObject::objects[Config::activeObjectsMax];
+activeObjectId_t ActiveObject::priorityToObject[activeObjectPrioritiesMax];
+volatile uint32_t ActiveObject::readyPriorities = 0UL;
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+void ActiveObject::Init(void)
+{
+    Hal::Isr::DisableGlobal();
+    for (std::size_t i = 0U; i < Config::activeObjectsMax; ++i)
+    {
+        objects[i].Dispatch = 0;
+        objects[i].queue = Utils::QueueView<aoEvent_t>();
+    }
+    for (std::size_t i = 0U; i < activeObjectPrioritiesMax; ++i)
+    {
+        priorityToObject[i] = invalidActiveObjectId;
+    }
+    readyPriorities = 0UL;
+    Hal::Isr::EnableGlobal();
+    return;
+}
+
+activeObjectId_t ActiveObject::Create(aoDispatcher_t Dispatch, uint8_t priority, aoEvent_t* pQueue, std::size_t queueSize)
+{
+    activeObjectId_t object = invalidActiveObjectId;
+
+    if ((Dispatch == 0) || (pQueue == 0) || (queueSize == 0U) || (priority >= activeObjectPrioritiesMax) ||
+        (IsPriorityTaken(priority) == true))
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else
+    {
+        for (std::size_t i = 0U; (i < Config::activeObjectsMax) && (object == invalidActiveObjectId); ++i)
+        {
+            if (objects[i].Dispatch == 0)
+            {
+                object = static_cast<activeObjectId_t>(i);
+            }
+        }
+
+        if (object == invalidActiveObjectId)
+        {
+            System::Error(SysError::insufficientResources);
+        }
+        else
+        {
+            objects[object].queue = Utils::QueueView<aoEvent_t>(pQueue, queueSize);
+            objects[object].droppedEventCount = 0UL;
+            objects[object].priority = priority;
+            objects[object].Dispatch = Dispatch;
+            priorityToObject[priority] = object;
+        }
+    }
+
+    return object;
+}
+
+bool ActiveObject::Post(activeObjectId_t object, aoEvent_t const& event)
+{
+    bool errors = true;
+
+    if (IsValid(object) == true)
+    {
+        activeObject_t& activeObject = objects[object];
+
+        Hal::Isr::DisableGlobal();
+        errors = activeObject.queue.Push(event);
+        if (errors == false)
+        {
+            readyPriorities |= Utils::Bit(activeObject.priority);
+        }
+        else
+        {
+            ++activeObject.droppedEventCount;
+        }
+        Hal::Isr::EnableGlobal();
+
+        if (errors == false)
+        {
+            Hal::System::WakeUp();
+        }
+    }
+
+    return errors;
+}
+
+std::size_t ActiveObject::GetNumberOfEvents(activeObjectId_t object)
+{
+    std::size_t numberOfEvents = 0U;
+
+    if (IsValid(object) == true)
+    {
+        numberOfEvents = objects[object].queue.GetNumberOfElements();
+    }
+
+    return numberOfEvents;
+}
+
+uint32_t ActiveObject::GetDroppedEventCount(activeObjectId_t object)
+{
+    uint32_t droppedEventCount = 0UL;
+
+    if (IsValid(object) == true)
+    {
+        droppedEventCount = objects[object].droppedEventCount;
+    }
+
+    return droppedEventCount;
+}
+
+bool ActiveObject::Run(void)
+{
+    bool isDispatched = false;
+    aoDispatcher_t Dispatch = 0;
+    aoEvent_t event;
+
+    Hal::Isr::DisableGlobal();
+    if (readyPriorities != 0UL)
+    {
+        uint8_t priority = static_cast<uint8_t>(31U - static_cast<uint32_t>(__builtin_clz(readyPriorities)));
+        activeObject_t& activeObject = objects[priorityToObject[priority]];
+
+        (void)activeObject.queue.Pop(event);
+        if (activeObject.queue.GetNumberOfElements() == 0U)
+        {
+            readyPriorities &= ~Utils::Bit(priority);
+        }
+        Dispatch = activeObject.Dispatch;
+    }
+    Hal::Isr::EnableGlobal();
+
+    // The event is dispatched outside the critical section, so new events can be posted from ISRs meanwhile.
+    if (Dispatch != 0)
+    {
+        Dispatch(event);
+        isDispatched = true;
+    }
+
+    return isDispatched;
+}
+
+#if (UNIT_TEST == 1)
+void ActiveObject::Deinit(void)
+{
+    Init();
+    return;
+}
+#endif
+
+bool ActiveObject::IsValid(activeObjectId_t object)
+{
+    bool isValid = (object < Config::activeObjectsMax) && (objects[object].Dispatch != 0);
+
+    if (isValid == false)
+    {
+        System::Error(SysError::invalidParameters);
+    }
+
+    return isValid;
+}
+
+bool ActiveObject::IsPriorityTaken(uint8_t priority)
+{
+    bool isTaken = false;
+
+    // The objects are searched instead of priorityToObject, so creating objects does not depend on Init having been called.
+    for (std::size_t i = 0U; (i < Config::activeObjectsMax) && (isTaken == false); ++i)
+    {
+        isTaken = (objects[i].Dispatch != 0) && (objects[i].priority == priority);
+    }
+
+    return isTaken;
+}
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 7. Global Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 8. Static Functions
+//-----------------------------------------------------------------------------------------------------------------------------
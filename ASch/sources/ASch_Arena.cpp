@@ -0,0 +1,155 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Arena.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Arena
+//! @brief   This is the init-phase memory arena of ASch.
+//! 
+//! The arena is a bump-pointer allocator that is sealed when the scheduler is started.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_Arena.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Local Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 6. Class Member Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//---------------------------------------
+// Initialise static members
+//---------------------------------------
+uint64_t Arena::memory[(Config::arenaSize + 7U) / 8U] ARENA_SECTION;
+std::size_t Arena::usedBytes = 0U;
+std::size_t Arena::ownerUsage[Arena::ownerCount] = {0U};
+bool Arena::isSealed = false;
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+void* Arena::Allocate(ArenaOwner owner, std::size_t size, std::size_t alignment)
+{
+    void* pMemory = 0;
+
+    if ((owner >= ArenaOwner::invalid) || (size == 0U) || (alignment == 0U) || ((alignment & (alignment - 1U)) != 0U))
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else if (isSealed == true)
+    {
+        System::Error(SysError::accessNotPermitted);
+    }
+    else
+    {
+        uintptr_t base = reinterpret_cast<uintptr_t>(memory);
+        uintptr_t start = (base + usedBytes + (alignment - 1U)) & ~static_cast<uintptr_t>(alignment - 1U);
+        std::size_t offset = static_cast<std::size_t>(start - base);
+
+        if ((offset > Config::arenaSize) || (size > (Config::arenaSize - offset)))
+        {
+            System::Error(SysError::insufficientResources);
+        }
+        else
+        {
+            // The alignment padding is charged to the owner that caused it.
+            ownerUsage[static_cast<std::size_t>(owner)] += (offset + size) - usedBytes;
+            usedBytes = offset + size;
+            pMemory = reinterpret_cast<void*>(start);
+        }
+    }
+    return pMemory;
+}
+
+void Arena::Seal(void)
+{
+    isSealed = true;
+    return;
+}
+
+bool Arena::IsSealed(void)
+{
+    return isSealed;
+}
+
+std::size_t Arena::GetUsage(ArenaOwner owner)
+{
+    std::size_t usage = 0U;
+
+    if (owner < ArenaOwner::invalid)
+    {
+        usage = ownerUsage[static_cast<std::size_t>(owner)];
+    }
+    return usage;
+}
+
+std::size_t Arena::GetTotalUsage(void)
+{
+    return usedBytes;
+}
+
+std::size_t Arena::GetFree(void)
+{
+    return Config::arenaSize - usedBytes;
+}
+
+#if (UNIT_TEST == 1)
+void Arena::Deinit(void)
+{
+    for (std::size_t i = 0U; i < ownerCount; ++i)
+    {
+        ownerUsage[i] = 0U;
+    }
+    usedBytes = 0U;
+    isSealed = false;
+    return;
+}
+#endif
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 7. Global Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 8. Static Functions
+//-----------------------------------------------------------------------------------------------------------------------------
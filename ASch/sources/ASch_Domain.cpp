@@ -0,0 +1,239 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Domain.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Domain
+//! @brief   This is a scheduler domain of ASch.
+//! 
+//! The implementation is not a template, so the code is shared by all the domains regardless of their capacities. The
+//! task table and the event queue are protected with global interrupt disabling since the owner of a domain may tick it
+//! from any interrupt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_Domain.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Local Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 6. Class Member Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+void Domain::CreateTask(task_t const& task)
+{
+    if ((task.Task == 0) || (task.intervalInMs == 0U))
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else
+    {
+        Hal::Isr::DisableGlobal();
+        std::size_t taskId = 0U;
+        while ((taskId < taskCount) && (pTasks[taskId].Task != task.Task))
+        {
+            ++taskId;
+        }
+
+        if (taskId < taskCount)
+        {
+            // In case of duplicates, just update the interval.
+            pTasks[taskId].intervalInMs = task.intervalInMs;
+        }
+        else if (taskCount < taskCapacity)
+        {
+            pTasks[taskCount] = {.intervalInMs = task.intervalInMs, .Task = task.Task, .msCounter = task.intervalInMs,
+                                 .isDue = false};
+            ++taskCount;
+        }
+        else
+        {
+            System::Error(SysError::insufficientResources);
+        }
+        Hal::Isr::EnableGlobal();
+    }
+    return;
+}
+
+void Domain::DeleteTask(taskHandler_t Task)
+{
+    Hal::Isr::DisableGlobal();
+    bool isRemoved = false;
+    for (std::size_t i = 0U; i < taskCount; ++i)
+    {
+        if (isRemoved == true)
+        {
+            pTasks[i - 1U] = pTasks[i];
+        }
+        else if (pTasks[i].Task == Task)
+        {
+            isRemoved = true;
+        }
+    }
+
+    if (isRemoved == true)
+    {
+        --taskCount;
+    }
+    Hal::Isr::EnableGlobal();
+    return;
+}
+
+std::size_t Domain::GetTaskCount(void) const
+{
+    return taskCount;
+}
+
+void Domain::PushEvent(event_t const& event)
+{
+    if (event.Handler == 0)
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else
+    {
+        Hal::Isr::DisableGlobal();
+        if (eventCount < eventCapacity)
+        {
+            std::size_t index = nextEvent + eventCount;
+            if (index >= eventCapacity)
+            {
+                index -= eventCapacity;
+            }
+            pEvents[index] = event;
+            ++eventCount;
+        }
+        else
+        {
+            System::Error(SysError::insufficientResources);
+        }
+        Hal::Isr::EnableGlobal();
+    }
+    return;
+}
+
+std::size_t Domain::GetNumberOfEvents(void) const
+{
+    return eventCount;
+}
+
+void Domain::Tick(void)
+{
+    for (std::size_t i = 0U; i < taskCount; ++i)
+    {
+        if (pTasks[i].msCounter > msPerTick)
+        {
+            pTasks[i].msCounter -= msPerTick;
+        }
+        else
+        {
+            pTasks[i].msCounter = pTasks[i].intervalInMs;
+            pTasks[i].isDue = true;
+            isPending = true;
+        }
+    }
+    return;
+}
+
+bool Domain::Run(void)
+{
+    bool isRun = false;
+
+    if (isPending == true)
+    {
+        isPending = false;
+        for (std::size_t i = 0U; i < taskCount; ++i)
+        {
+            if (pTasks[i].isDue == true)
+            {
+                pTasks[i].isDue = false;
+                Config::Hooks::TaskStart(pTasks[i].Task);
+                pTasks[i].Task();
+                Config::Hooks::TaskEnd(pTasks[i].Task);
+                isRun = true;
+            }
+        }
+    }
+
+    event_t event;
+    while (PopEvent(event) == true)
+    {
+        Config::Hooks::EventStart(event.Handler);
+        event.Handler(event.pPayload);
+        Config::Hooks::EventEnd(event.Handler);
+        isRun = true;
+    }
+
+    return isRun;
+}
+
+bool Domain::PopEvent(event_t& event)
+{
+    bool isPopped = false;
+
+    Hal::Isr::DisableGlobal();
+    if (eventCount > 0U)
+    {
+        event = pEvents[nextEvent];
+        ++nextEvent;
+        if (nextEvent >= eventCapacity)
+        {
+            nextEvent = 0U;
+        }
+        --eventCount;
+        isPopped = true;
+    }
+    Hal::Isr::EnableGlobal();
+
+    return isPopped;
+}
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 7. Global Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 8. Static Functions
+//-----------------------------------------------------------------------------------------------------------------------------
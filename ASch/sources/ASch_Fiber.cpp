@@ -0,0 +1,304 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Fiber.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Fiber
+//! @brief   This is the fiber module of ASch.
+//! 
+//! The fibers are switched cooperatively with HAL Context. The fiber stacks are placed in the uninitialised CCMRAM section
+//! on target, so they take no space in flash and must not be used as DMA buffers.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_Fiber.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#if (UNIT_TEST == 1)
+    #define FIBER_STACK_SECTION
+#else
+    #define FIBER_STACK_SECTION     __attribute__((section(".ccmram_bss")))
+#endif
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Local Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 6. Class Member Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//---------------------------------------
+// Initialise static members
+//---------------------------------------
+Fiber::fiber_t Fiber::fibers[Config::fibersMax];
+uint64_t Fiber::stacks[Config::fibersMax][Config::fiberStackSize / sizeof(uint64_t)] FIBER_STACK_SECTION;
+Hal::context_t Fiber::mainContext;
+fiberId_t Fiber::currentFiber = invalidFiberId;
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+void Fiber::Init(void)
+{
+    for (std::size_t i = 0U; i < Config::fibersMax; ++i)
+    {
+        fibers[i].Handler = 0;
+        fibers[i].state = FiberState::free;
+    }
+    currentFiber = invalidFiberId;
+    return;
+}
+
+fiberId_t Fiber::Create(fiberHandler_t Handler)
+{
+    fiberId_t fiber = invalidFiberId;
+
+    if (Handler == 0)
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else
+    {
+        for (std::size_t i = 0U; (i < Config::fibersMax) && (fiber == invalidFiberId); ++i)
+        {
+            if (fibers[i].state == FiberState::free)
+            {
+                fiber = static_cast<fiberId_t>(i);
+            }
+        }
+
+        if (fiber == invalidFiberId)
+        {
+            System::Error(SysError::insufficientResources);
+        }
+        else
+        {
+            fibers[fiber].Handler = Handler;
+            fibers[fiber].delayInMs = 0UL;
+            fibers[fiber].waitedEvents = 0UL;
+            fibers[fiber].pendingEvents = 0UL;
+            Hal::Context::Init(fibers[fiber].context, static_cast<void*>(stacks[fiber]), sizeof(stacks[fiber]), Fiber::Entry);
+            fibers[fiber].state = FiberState::ready;
+        }
+    }
+
+    return fiber;
+}
+
+void Fiber::Delay(uint32_t delayInMs)
+{
+    if (IsCalledFromFiber() == true)
+    {
+        fibers[currentFiber].delayInMs = delayInMs;
+        fibers[currentFiber].state = FiberState::delayed;
+        Yield();
+    }
+    return;
+}
+
+uint32_t Fiber::Wait(uint32_t events)
+{
+    uint32_t receivedEvents = 0UL;
+
+    if (events == 0UL)
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else if (IsCalledFromFiber() == true)
+    {
+        fiber_t& fiber = fibers[currentFiber];
+
+        Hal::Isr::DisableGlobal();
+        if ((fiber.pendingEvents & events) == 0UL)
+        {
+            fiber.waitedEvents = events;
+            fiber.state = FiberState::waiting;
+        }
+        Hal::Isr::EnableGlobal();
+
+        if (fiber.state == FiberState::waiting)
+        {
+            Yield();
+        }
+
+        Hal::Isr::DisableGlobal();
+        receivedEvents = fiber.pendingEvents & events;
+        fiber.pendingEvents &= ~receivedEvents;
+        Hal::Isr::EnableGlobal();
+    }
+
+    return receivedEvents;
+}
+
+void Fiber::Signal(fiberId_t fiber, uint32_t events)
+{
+    if ((fiber >= Config::fibersMax) || (fibers[fiber].state == FiberState::free))
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else
+    {
+        Hal::Isr::DisableGlobal();
+        fibers[fiber].pendingEvents |= events;
+        Hal::Isr::EnableGlobal();
+        Hal::System::WakeUp();
+    }
+    return;
+}
+
+fiberId_t Fiber::GetCurrent(void)
+{
+    return currentFiber;
+}
+
+bool Fiber::Run(void)
+{
+    bool isFiberRun = false;
+
+    for (std::size_t i = 0U; i < Config::fibersMax; ++i)
+    {
+        if (IsReady(static_cast<fiberId_t>(i)) == true)
+        {
+            fibers[i].state = FiberState::ready;
+            currentFiber = static_cast<fiberId_t>(i);
+            Hal::Context::Switch(mainContext, fibers[i].context);
+            currentFiber = invalidFiberId;
+            isFiberRun = true;
+        }
+    }
+
+    return isFiberRun;
+}
+
+void Fiber::Tick(uint32_t elapsedInMs)
+{
+    bool isWakeUpNeeded = false;
+
+    for (std::size_t i = 0U; i < Config::fibersMax; ++i)
+    {
+        if ((fibers[i].state == FiberState::delayed) && (fibers[i].delayInMs > 0UL))
+        {
+            if (fibers[i].delayInMs > elapsedInMs)
+            {
+                fibers[i].delayInMs -= elapsedInMs;
+            }
+            else
+            {
+                fibers[i].delayInMs = 0UL;
+                isWakeUpNeeded = true;
+            }
+        }
+    }
+
+    if (isWakeUpNeeded == true)
+    {
+        Hal::System::WakeUp();
+    }
+    return;
+}
+
+#if (UNIT_TEST == 1)
+void Fiber::Deinit(void)
+{
+    Init();
+    return;
+}
+#endif
+
+bool Fiber::IsReady(fiberId_t fiber)
+{
+    bool isReady = false;
+
+    switch (fibers[fiber].state)
+    {
+        case FiberState::ready:
+            isReady = true;
+            break;
+
+        case FiberState::delayed:
+            isReady = (fibers[fiber].delayInMs == 0UL);
+            break;
+
+        case FiberState::waiting:
+            isReady = ((fibers[fiber].pendingEvents & fibers[fiber].waitedEvents) != 0UL);
+            break;
+
+        default:
+            break;
+    }
+
+    return isReady;
+}
+
+void Fiber::Yield(void)
+{
+    Hal::Context::Switch(fibers[currentFiber].context, mainContext);
+    return;
+}
+
+void Fiber::Entry(void)
+{
+    fibers[currentFiber].Handler();
+
+    // The fiber has ended. Its slot is freed and it is never resumed.
+    fibers[currentFiber].state = FiberState::free;
+    Yield();
+    return;
+}
+
+bool Fiber::IsCalledFromFiber(void)
+{
+    bool isFiber = (currentFiber != invalidFiberId);
+
+    if (isFiber == false)
+    {
+        System::Error(SysError::accessNotPermitted);
+    }
+
+    return isFiber;
+}
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 7. Global Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 8. Static Functions
+//-----------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,194 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_Preemption.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Preemption
+//! @brief   This is the preemptive priority level module of ASch.
+//! 
+//! The module runs events and tasks to completion in software triggered interrupts, one interrupt per priority level.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_Preemption.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Local Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 6. Class Member Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//---------------------------------------
+// Initialise static members
+//---------------------------------------
+const Hal::interruptHandler_t Preemption::levelHandlers[preemptionLevelsMax] =
+{
+    LevelHandler<0>, LevelHandler<1>, LevelHandler<2>, LevelHandler<3>,
+    LevelHandler<4>, LevelHandler<5>, LevelHandler<6>, LevelHandler<7>
+};
+
+Utils::Queue<Preemption::job_t, Config::preemptionEventsMax> Preemption::levelQueues[preemptionLevelCount];
+volatile uint8_t Preemption::currentLevel = 0U;
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+void Preemption::Init(void)
+{
+    currentLevel = 0U;
+
+    for (std::size_t i = 0U; i < preemptionLevelCount; ++i)
+    {
+        levelQueues[i].Flush();
+        Hal::Isr::SetHandler(Config::preemptionLevels[i].interrupt, levelHandlers[i]);
+        Hal::Isr::SetPriority(Config::preemptionLevels[i].interrupt, Config::preemptionLevels[i].priority);
+        Hal::Isr::Enable(Config::preemptionLevels[i].interrupt);
+    }
+    return;
+}
+
+void Preemption::PostEvent(uint8_t level, event_t const& event)
+{
+    if (level == 0U)
+    {
+        Scheduler::PushEvent(event);
+    }
+    else if (event.Handler != 0)
+    {
+        PostJob(level, {.Handler = event.Handler, .pPayload = event.pPayload, .Task = 0});
+    }
+    return;
+}
+
+void Preemption::PostTask(uint8_t level, taskHandler_t Task)
+{
+    if (level == 0U)
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else if (Task != 0)
+    {
+        PostJob(level, {.Handler = 0, .pPayload = 0, .Task = Task});
+    }
+    return;
+}
+
+uint8_t Preemption::GetCurrentLevel(void)
+{
+    return currentLevel;
+}
+
+#if (UNIT_TEST == 1)
+void Preemption::Deinit(void)
+{
+    currentLevel = 0U;
+    for (std::size_t i = 0U; i < preemptionLevelCount; ++i)
+    {
+        levelQueues[i].Flush();
+    }
+    return;
+}
+#endif
+
+void Preemption::PostJob(uint8_t level, job_t const& job)
+{
+    if (level > preemptionLevelCount)
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else
+    {
+        std::size_t index = static_cast<std::size_t>(level - 1U);
+
+        Hal::Isr::DisableGlobal();
+        bool errors = levelQueues[index].Push(job);
+        Hal::Isr::EnableGlobal();
+
+        if (errors == true)
+        {
+            System::Error(SysError::insufficientResources);
+        }
+        else
+        {
+            Hal::Isr::SetPending(Config::preemptionLevels[index].interrupt);
+        }
+    }
+    return;
+}
+
+void Preemption::RunLevel(std::size_t index)
+{
+    uint8_t preemptedLevel = currentLevel;
+    currentLevel = static_cast<uint8_t>(index + 1U);
+
+    bool isEmpty = false;
+    do
+    {
+        job_t job;
+        Hal::Isr::DisableGlobal();
+        isEmpty = levelQueues[index].Pop(job);
+        Hal::Isr::EnableGlobal();
+
+        if (isEmpty == false)
+        {
+            if (job.Task != 0)
+            {
+                job.Task();
+            }
+            else
+            {
+                job.Handler(job.pPayload);
+            }
+        }
+    } while (isEmpty == false);
+
+    currentLevel = preemptedLevel;
+    return;
+}
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 7. Global Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 8. Static Functions
+//-----------------------------------------------------------------------------------------------------------------------------
@@ -31,8 +31,16 @@
 // 1. Include Files
 //-----------------------------------------------------------------------------------------------------------------------------
 
+#if (UNIT_TEST == 1)
+    #define SCHEDULER_UNIT_TEST     // For enabling test functions in ASch_TestConfiguration.hpp
+#endif
+
 #include <ASch_Scheduler.hpp>
 #include <ASch_Scheduler_Private.hpp>
+#include <ASch_Preemption.hpp>
+#include <ASch_Fiber.hpp>
+#include <ASch_ActiveObject.hpp>
+#include <ASch_Arena.hpp>
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // 2. Typedefs, Structs, Enums and Constants
@@ -60,20 +68,50 @@ namespace ASch
 //---------------------------------------
 // Initialise static members
 //---------------------------------------
-Scheduler::taskState_t Scheduler::taskStates[] = {{.msCounter = 0U, .isRunning = false}};
+Scheduler::taskState_t Scheduler::taskStates[] = {{.msCounter = 0U, .isRunning = false, .maxCycles = 0UL}};
 volatile bool Scheduler::runTasks = false;
 volatile bool Scheduler::runEvents = false;
-uint8_t Scheduler::msPerTick = 0U;
+uint16_t Scheduler::msPerTick = 0U;
 
 SchedulerStatus Scheduler::status = SchedulerStatus::idle;
+AdmissionPolicy Scheduler::admissionPolicy = AdmissionPolicy::none;
+bool Scheduler::isElasticModeEnabled = false;
+bool Scheduler::isOverloaded = false;
+uint16_t Scheduler::loadWindowMs = 0U;
+volatile bool Scheduler::isLoadWindowElapsed = false;
+uint32_t Scheduler::busyCycles = 0UL;
+uint32_t Scheduler::load = 0UL;
+volatile uint32_t Scheduler::deadlineMissCount = 0UL;
+volatile uint8_t Scheduler::windowDeadlineMisses = 0U;
+
+ScheduleMode Scheduler::scheduleMode = ScheduleMode::invalid;
+volatile ScheduleMode Scheduler::pendingScheduleMode = ScheduleMode::invalid;
+volatile bool Scheduler::isPendingPhasePreserved = false;
+volatile uint16_t Scheduler::modeSwitchTicks = 0U;
 
-uint8_t Scheduler::taskCount = 0U;
+taskId_t Scheduler::taskCount = 0U;
 task_t Scheduler::tasks[Config::schedulerTasksMax] = {{.intervalInMs = 0U, .Task = 0}};
 
-Utils::Queue<event_t, Config::schedulerEventsMax> Scheduler::eventQueue = Utils::Queue<event_t, Config::schedulerEventsMax>();
+Scheduler::taskLinkIndex_t Scheduler::taskLinkCount = 0U;
+Scheduler::taskLink_t Scheduler::taskLinks[Config::schedulerTaskLinksMax] = {{.Predecessor = 0, .Successor = 0, .isDone = false}};
 
-uint8_t Scheduler::messageListenerCount = 0U;
-messageListener_t Scheduler::messageListeners[Config::messageListenersMax] = {{.type = Message::invalid, .Handler = 0}};
+Utils::Queue<Scheduler::eventEntry_t, Config::schedulerEventsMax> Scheduler::eventQueue = Utils::Queue<eventEntry_t, Config::schedulerEventsMax>();
+EventOverflowPolicy Scheduler::eventOverflowPolicy = EventOverflowPolicy::systemError;
+eventOverflowHandler_t Scheduler::EventOverflowHandler = 0;
+uint32_t Scheduler::droppedEventCount = 0UL;
+bool Scheduler::isEventCoalescingEnabled = false;
+uint32_t Scheduler::coalescedEventCount = 0UL;
+
+Scheduler::payloadPool_t Scheduler::payloadPool;
+uint8_t Scheduler::payloadReferences[Config::payloadBlocksMax] = {0U};
+
+backgroundJob_t Scheduler::backgroundJobs[Config::backgroundJobsMax] = {0};
+Scheduler::backgroundJobIndex_t Scheduler::backgroundJobCount = 0U;
+Scheduler::backgroundJobIndex_t Scheduler::nextBackgroundJob = 0U;
+
+Scheduler::listenerIndex_t Scheduler::messageListenerCount = 0U;
+messageListener_t Scheduler::messageListeners[Config::messageListenersMax] = {{.type = Message::invalid, .Handler = 0, .topics = Topic::none}};
+bool Scheduler::isDispatchingMessage = false;
 
 //---------------------------------------
 // Functions
@@ -90,10 +128,10 @@ void Scheduler::Init(uint16_t tickIntervalInMs)
     }
     else
     {
-        for (uint8_t i = 0U; i < Config::schedulerTasksMax; ++i)
+        for (taskId_t i = 0U; i < Config::schedulerTasksMax; ++i)
         {
             tasks[i] = {.intervalInMs = 0U, .Task = 0};
-            taskStates[i] = {.msCounter = 0U, .isRunning = false};
+            taskStates[i] = {.msCounter = 0U, .isRunning = false, .maxCycles = 0UL};
         }
 
         msPerTick = tickIntervalInMs;
@@ -101,10 +139,39 @@ void Scheduler::Init(uint16_t tickIntervalInMs)
         runEvents = false;
 
         taskCount = 0U;
+        taskLinkCount = 0U;
+        scheduleMode = ScheduleMode::invalid;
+        pendingScheduleMode = ScheduleMode::invalid;
+        isPendingPhasePreserved = false;
+        modeSwitchTicks = 0U;
+        admissionPolicy = AdmissionPolicy::none;
+        isElasticModeEnabled = false;
+        isOverloaded = false;
+        loadWindowMs = 0U;
+        isLoadWindowElapsed = false;
+        busyCycles = 0UL;
+        load = 0UL;
+        deadlineMissCount = 0UL;
+        windowDeadlineMisses = 0U;
         eventQueue.Flush();
+        eventOverflowPolicy = EventOverflowPolicy::systemError;
+        EventOverflowHandler = 0;
+        droppedEventCount = 0UL;
+        isEventCoalescingEnabled = false;
+        coalescedEventCount = 0UL;
         messageListenerCount = 0U;
+        isDispatchingMessage = false;
         status = SchedulerStatus::idle;
 
+        for (std::size_t i = 0U; i < Config::payloadBlocksMax; ++i)
+        {
+            payloadReferences[i] = 0U;
+        }
+        payloadPool.Reset();
+
+        backgroundJobCount = 0U;
+        nextBackgroundJob = 0U;
+
         Hal::SysTick::SetInterval(tickIntervalInMs);
         Hal::Isr::SetHandler(Hal::Interrupt::sysTick, Scheduler::TickHandler);
     }
@@ -113,6 +180,8 @@ void Scheduler::Init(uint16_t tickIntervalInMs)
 
 void Scheduler::Start(void)
 {
+    // The init phase ends here, so the memory usage is fixed from now on.
+    Arena::Seal();
     Hal::Isr::Enable(Hal::Interrupt::sysTick);
     Hal::SysTick::Start();
     status = SchedulerStatus::running;
@@ -132,25 +201,38 @@ SchedulerStatus Scheduler::GetStatus(void)
     return status;
 }
 
-uint8_t Scheduler::GetTaskCount(void)
+taskId_t Scheduler::GetTaskCount(void)
 {
     return taskCount;
 }
 
-void Scheduler::CreateTask(task_t task)
+bool Scheduler::CreateTask(task_t task)
 {
-    if ((task.Task != 0) && (task.intervalInMs > 0U))
+    bool isRejected = true;
+
+    if (task.level > preemptionLevelCount)
+    {
+        // Caught here rather than when the tick handler posts the task to the level.
+        ThrowError(SysError::invalidParameters);
+    }
+    else if (task.Task != 0)
     {
         Hal::Isr::DisableGlobal();
-        if (taskCount < Config::schedulerTasksMax)
+        if ((admissionPolicy == AdmissionPolicy::reject) && (IsAdmissible(task) == false))
+        {
+            // The task is refused without a system error, so the caller can carry on with the current task set.
+        }
+        else if (taskCount < Config::schedulerTasksMax)
         {
             bool isDuplicate = false;
-            for (uint8_t i = 0U; i < taskCount; ++i)
+            for (taskId_t i = 0U; i < taskCount; ++i)
             {
                 if (tasks[i].Task == task.Task)
                 {
-                    // In case of duplicates, just update the interval.
+                    // In case of duplicates, just update the interval, the level and the WCET.
                     tasks[i].intervalInMs = task.intervalInMs;
+                    tasks[i].level = task.level;
+                    tasks[i].wcetInUs = task.wcetInUs;
                     isDuplicate = true;
                     break;
                 }
@@ -161,8 +243,10 @@ void Scheduler::CreateTask(task_t task)
                 tasks[taskCount] = task;
                 taskStates[taskCount].msCounter = task.intervalInMs;
                 taskStates[taskCount].isRunning = false;
+                taskStates[taskCount].maxCycles = 0UL;
                 ++taskCount;
             }
+            isRejected = false;
         }
         else
         {
@@ -170,13 +254,13 @@ void Scheduler::CreateTask(task_t task)
         }
         Hal::Isr::EnableGlobal();
     }
-    return;
+    return isRejected;
 }
 
 void Scheduler::DeleteTask(taskHandler_t taskHandler)
 {
     bool taskIsRemoved = false;
-    for (uint8_t i = 0U; i < taskCount; ++i)
+    for (taskId_t i = 0U; i < taskCount; ++i)
     {
         if (taskIsRemoved == false)
         {
@@ -188,17 +272,63 @@ void Scheduler::DeleteTask(taskHandler_t taskHandler)
         else
         {
             tasks[i - 1] = tasks[i];
+            taskStates[i - 1] = taskStates[i];
         }
     }
 
     if (taskIsRemoved == true)
     {
         --taskCount;
+        RemoveTaskLinks(taskHandler);
+    }
+    return;
+}
+
+void Scheduler::LinkTasks(taskHandler_t Predecessor, taskHandler_t Successor)
+{
+    taskId_t predecessorId = GetTaskId(Predecessor);
+    taskId_t successorId = GetTaskId(Successor);
+
+    if ((predecessorId >= taskCount) || (successorId >= taskCount) ||
+        (tasks[predecessorId].level > 0U) || (tasks[successorId].level > 0U) ||
+        (IsTaskReachable(Successor, Predecessor) == true))
+    {
+        ThrowError(SysError::invalidParameters);
+    }
+    else if (taskLinkCount < Config::schedulerTaskLinksMax)
+    {
+        taskLinks[taskLinkCount] = {.Predecessor = Predecessor, .Successor = Successor, .isDone = false};
+        ++taskLinkCount;
+    }
+    else
+    {
+        ThrowError(SysError::insufficientResources);
     }
     return;
 }
 
-uint16_t Scheduler::GetTaskInterval(uint8_t taskId)
+void Scheduler::SwitchMode(ScheduleMode mode, bool isPhasePreserved)
+{
+    if (mode >= ScheduleMode::invalid)
+    {
+        ThrowError(SysError::invalidParameters);
+    }
+    else
+    {
+        Hal::Isr::DisableGlobal();
+        pendingScheduleMode = mode;
+        isPendingPhasePreserved = isPhasePreserved;
+        Hal::Isr::EnableGlobal();
+    }
+    return;
+}
+
+ScheduleMode Scheduler::GetScheduleMode(void)
+{
+    return scheduleMode;
+}
+
+uint16_t Scheduler::GetTaskInterval(taskId_t taskId)
 {
     uint16_t interval;
 
@@ -214,16 +344,140 @@ uint16_t Scheduler::GetTaskInterval(uint8_t taskId)
     return interval;
 }
 
+void Scheduler::SetAdmissionPolicy(AdmissionPolicy policy)
+{
+    admissionPolicy = policy;
+    return;
+}
+
+uint32_t Scheduler::GetTaskWcet(taskId_t taskId)
+{
+    uint32_t wcetInUs = 0UL;
+
+    if (taskId < taskCount)
+    {
+        wcetInUs = tasks[taskId].wcetInUs;
+        if (wcetInUs == 0UL)
+        {
+            wcetInUs = (taskStates[taskId].maxCycles + Config::cpuCyclesPerUs - 1UL) / Config::cpuCyclesPerUs;
+        }
+    }
+
+    return wcetInUs;
+}
+
+uint32_t Scheduler::GetUtilisation(void)
+{
+    uint32_t utilisation = 0UL;
+
+    for (taskId_t i = 0U; i < taskCount; ++i)
+    {
+        utilisation += GetTaskUtilisation(tasks[i], taskStates[i].maxCycles);
+    }
+
+    return utilisation;
+}
+
+bool Scheduler::IsSchedulable(void)
+{
+    std::size_t periodicTaskCount = 0U;
+
+    for (taskId_t i = 0U; i < taskCount; ++i)
+    {
+        if (tasks[i].intervalInMs > 0U)
+        {
+            ++periodicTaskCount;
+        }
+    }
+
+    return (GetUtilisation() <= GetUtilisationBound(periodicTaskCount));
+}
+
+void Scheduler::SetElasticMode(bool isEnabled)
+{
+    Hal::Isr::DisableGlobal();
+    isElasticModeEnabled = isEnabled;
+    isOverloaded = false;
+    loadWindowMs = 0U;
+    isLoadWindowElapsed = false;
+    busyCycles = 0UL;
+    windowDeadlineMisses = 0U;
+    Hal::Isr::EnableGlobal();
+    return;
+}
+
+bool Scheduler::IsOverloaded(void)
+{
+    return isOverloaded;
+}
+
+uint32_t Scheduler::GetLoad(void)
+{
+    return load;
+}
+
+uint32_t Scheduler::GetDeadlineMissCount(void)
+{
+    return deadlineMissCount;
+}
+
 void Scheduler::RunTasks(void)
 {
-    for (uint8_t taskId = 0U; taskId < taskCount; ++taskId)
+    if (modeSwitchTicks > 0U)
     {
-        if (taskStates[taskId].isRunning == true)
+        // The switch is applied here rather than in the tick handler, so the task tables are never changed under a
+        // running task loop.
+        uint16_t levelActivations[Config::schedulerTasksMax] = {0U};
+
+        Hal::Isr::DisableGlobal();
+        ApplyScheduleMode(levelActivations);
+        Hal::Isr::EnableGlobal();
+
+        // Posting to a level enables the interrupts, so the caught-up preemptive activations are posted only here.
+        for (taskId_t i = 0U; i < taskCount; ++i)
         {
-            taskStates[taskId].isRunning = false;
-            tasks[taskId].Task();
+            for (uint16_t activation = 0U; activation < levelActivations[i]; ++activation)
+            {
+                Preemption::PostTask(tasks[i].level, tasks[i].Task);
+            }
         }
     }
+
+    if (isLoadWindowElapsed == true)
+    {
+        EvaluateLoad();
+    }
+
+    bool isReleased;
+    do
+    {
+        // Another round is needed if a stage with a lower ID than its predecessor was released.
+        isReleased = false;
+        for (taskId_t taskId = 0U; taskId < taskCount; ++taskId)
+        {
+            if (taskStates[taskId].isRunning == true)
+            {
+                taskStates[taskId].isRunning = false;
+                Config::Hooks::TaskStart(tasks[taskId].Task);
+                uint32_t startCycles = Hal::System::GetCycleCount();
+                tasks[taskId].Task();
+                uint32_t cycles = Hal::System::GetCycleCount() - startCycles;
+                Config::Hooks::TaskEnd(tasks[taskId].Task);
+                if (cycles > taskStates[taskId].maxCycles)
+                {
+                    taskStates[taskId].maxCycles = cycles;
+                }
+                if (isElasticModeEnabled == true)
+                {
+                    busyCycles += cycles;
+                }
+                if ((taskLinkCount > 0U) && (ReleaseSuccessors(tasks[taskId].Task) == true))
+                {
+                    isReleased = true;
+                }
+            }
+        }
+    } while (isReleased == true);
     return;
 }
 
@@ -243,30 +497,113 @@ void Scheduler::PushEvent(event_t const& event)
 {
     if (event.Handler != 0)
     {
-        Hal::Isr::DisableGlobal();
-        bool errors = eventQueue.Push(event);
+        eventEntry_t entry;
+        entry.Handler = event.Handler;
+        entry.pPayload = event.pPayload;
+        entry.kind = EntryKind::event;
+        PushEntry(entry);
+    }
+    return;
+}
 
-        if (errors == true)
-        {
-            ThrowError(SysError::insufficientResources);
-        }
-        else
+void Scheduler::PushInlineEvent(eventHandler_t Handler, const void* pData, std::size_t size)
+{
+    if ((size > Config::eventInlinePayloadSize) || ((pData == 0) && (size > 0U)))
+    {
+        ThrowError(SysError::invalidParameters);
+    }
+    else if (Handler != 0)
+    {
+        eventEntry_t entry;
+        entry.Handler = Handler;
+        entry.inlinePayload = InlinePayloadStorage<Config::eventInlinePayloadSize>();
+        entry.kind = EntryKind::inlineEvent;
+
+        const uint8_t* pSource = static_cast<const uint8_t*>(pData);
+        uint8_t* pDestination = static_cast<uint8_t*>(entry.inlinePayload.GetData());
+        for (std::size_t i = 0U; i < size; ++i)
         {
-            runEvents = true;
-            Hal::System::WakeUp();
+            pDestination[i] = pSource[i];
         }
-        Hal::Isr::EnableGlobal();
+
+        PushEntry(entry);
     }
     return;
 }
 
+void Scheduler::SetEventOverflowPolicy(EventOverflowPolicy policy)
+{
+    eventOverflowPolicy = policy;
+    return;
+}
+
+void Scheduler::SetEventOverflowHandler(eventOverflowHandler_t Handler)
+{
+    EventOverflowHandler = Handler;
+    return;
+}
+
+uint32_t Scheduler::GetDroppedEventCount(void)
+{
+    return droppedEventCount;
+}
+
+void Scheduler::SetEventCoalescing(bool isEnabled)
+{
+    isEventCoalescingEnabled = isEnabled;
+    return;
+}
+
+uint32_t Scheduler::GetCoalescedEventCount(void)
+{
+    return coalescedEventCount;
+}
+
 void Scheduler::RunEvents(void)
 {
+    std::size_t eventsInPass = 0U;
+    uint32_t passStartCycles = Hal::System::GetCycleCount();
+    const uint32_t startCycles = passStartCycles;
+
     while (eventQueue.GetNumberOfElements() > 0)
     {
-        event_t event;
-        eventQueue.Pop(event);
-        event.Handler(event.pPayload);
+        if (IsEventPassSpent(eventsInPass, passStartCycles) == true)
+        {
+            if (runTasks == true)
+            {
+                // Yield to the due tasks. The main loop continues with the remaining events after the tasks.
+                runEvents = true;
+                break;
+            }
+            eventsInPass = 0U;
+            passStartCycles = Hal::System::GetCycleCount();
+        }
+
+        eventEntry_t entry;
+        Hal::Isr::DisableGlobal();
+        eventQueue.Pop(entry);
+        Hal::Isr::EnableGlobal();
+
+        if ((entry.kind == EntryKind::event) || (entry.kind == EntryKind::inlineEvent))
+        {
+            CallEventHandler(entry.Handler, GetEntryPayload(entry));
+        }
+        else
+        {
+            DispatchMessage(entry.messageType, GetEntryPayload(entry));
+        }
+
+        if (entry.kind == EntryKind::pooledMessage)
+        {
+            // All the listeners have returned.
+            ReleasePayload(entry.payload);
+        }
+        ++eventsInPass;
+    }
+
+    if (isElasticModeEnabled == true)
+    {
+        busyCycles += Hal::System::GetCycleCount() - startCycles;
     }
     return;
 }
@@ -278,7 +615,7 @@ void Scheduler::RegisterMessageListener(messageListener_t const& listener)
         if (listener.Handler != 0)
         {
             bool isDuplicate = false;
-            for (uint8_t i = 0U; (i < messageListenerCount) && (isDuplicate == false); ++i)
+            for (listenerIndex_t i = 0U; (i < messageListenerCount) && (isDuplicate == false); ++i)
             {
                 isDuplicate = (messageListeners[i].Handler == listener.Handler);
             }
@@ -300,34 +637,35 @@ void Scheduler::RegisterMessageListener(messageListener_t const& listener)
 void Scheduler::UnregisterMessageListener(messageListener_t const& listener)
 {
     bool isFound = false;
-    for (uint8_t i = 0U; i < messageListenerCount; ++i)
+    for (listenerIndex_t i = 0U; (i < messageListenerCount) && (isFound == false); ++i)
     {
-        if (isFound == false)
-        {
-            if ((messageListeners[i].Handler == listener.Handler)
-                && (messageListeners[i].type == listener.type))
-            {
-                isFound = true;
-            }
-        }
-        else
+        if ((listener.Handler != 0) && (messageListeners[i].Handler == listener.Handler)
+            && (messageListeners[i].type == listener.type))
         {
-            messageListeners[i - 1U] = messageListeners[i];
+            // The listener is only marked here, so a message being dispatched does not skip the following listener.
+            messageListeners[i].Handler = 0;
+            isFound = true;
         }
     }
-    if (isFound == true)
+
+    if ((isFound == true) && (isDispatchingMessage == false))
     {
-        --messageListenerCount;
+        RemoveUnregisteredListeners();
     }
     return;
 }
 
-uint8_t Scheduler::GetNumberOfMessageListeners(Message type)
+std::size_t Scheduler::GetNumberOfMessageListeners(Message type)
 {
-    uint8_t listeners = 0U;
-    for (uint8_t i = 0U; i < messageListenerCount; ++i)
+    std::size_t listeners = 0U;
+    if (type < Message::invalid)
     {
-        if (messageListeners[i].type == type)
+        listeners = Config::messageRoutes[static_cast<std::size_t>(type)].count;
+    }
+
+    for (listenerIndex_t i = 0U; i < messageListenerCount; ++i)
+    {
+        if (IsListenerOf(messageListeners[i], type) == true)
         {
             ++listeners;
         }
@@ -337,87 +675,851 @@ uint8_t Scheduler::GetNumberOfMessageListeners(Message type)
 
 void Scheduler::PushMessage(message_t const& message)
 {
-    event_t event;
-    for (uint8_t i = 0U; i < messageListenerCount; ++i)
+    if (message.type >= Message::invalid)
     {
-        if (messageListeners[i].type == message.type)
-        {
-            event.Handler = messageListeners[i].Handler;
-            event.pPayload = message.pPayload;
-            PushEvent(event);
-        }
+        ThrowError(SysError::invalidParameters);
+    }
+    else if (HasMessageListeners(message.type) == true)
+    {
+        eventEntry_t entry;
+        entry.messageType = message.type;
+        entry.pPayload = message.pPayload;
+        entry.kind = EntryKind::message;
+        PushEntry(entry);
     }
     return;
 }
 
-void Scheduler::MainLoop(void)
+payloadHandle_t Scheduler::AllocatePayload(void)
 {
-    do
+    payloadHandle_t payload = noPayloadHandle;
+
+    Hal::Isr::DisableGlobal();
+    payloadBlock_t* pBlock = payloadPool.Allocate();
+    if (pBlock != 0)
     {
-        bool isIdle = true;
-        if (runTasks == true)
+        payload = static_cast<payloadHandle_t>(payloadPool.GetIndex(pBlock) + 1U);
+        payloadReferences[payload - 1U] = 1U;
+    }
+    Hal::Isr::EnableGlobal();
+
+    return payload;
+}
+
+void* Scheduler::GetPayload(payloadHandle_t payload)
+{
+    void* pPayload = 0;
+
+    if ((payload != noPayloadHandle) && (payload <= Config::payloadBlocksMax))
+    {
+        pPayload = static_cast<void*>(payloadPool.GetElement(payload - 1U)->data);
+    }
+
+    return pPayload;
+}
+
+void Scheduler::RetainPayload(payloadHandle_t payload)
+{
+    if ((payload != noPayloadHandle) && (payload <= Config::payloadBlocksMax))
+    {
+        bool isSaturated = false;
+
+        Hal::Isr::DisableGlobal();
+        if (payloadReferences[payload - 1U] == 0xFFU)
         {
-            runTasks = false;
-            Scheduler::RunTasks();
-            isIdle = false;
+            // Another reference would wrap the count to zero and free a block that is still in use.
+            isSaturated = true;
         }
-        if (runEvents == true)
+        else if (payloadReferences[payload - 1U] > 0U)
         {
-            runEvents = false;
-            Scheduler::RunEvents();
-            isIdle = false;
+            ++payloadReferences[payload - 1U];
         }
+        Hal::Isr::EnableGlobal();
 
-        // Enter sleep only after one idle run to ensure system is ready to sleep.
-        if (isIdle == true)
+        if (isSaturated == true)
         {
-            Scheduler::Sleep();
+            ThrowError(SysError::insufficientResources);
         }
-    } while (UNIT_TEST == 0);
+    }
     return;
 }
 
-void Scheduler::TickHandler(void)
+void Scheduler::ReleasePayload(payloadHandle_t payload)
+{
+    Hal::Isr::DisableGlobal();
+    ReleasePayloadReference(payload);
+    Hal::Isr::EnableGlobal();
+    return;
+}
+
+std::size_t Scheduler::GetNumberOfFreePayloads(void)
+{
+    return payloadPool.GetNumberOfFree();
+}
+
+std::size_t Scheduler::GetPayloadHighWaterMark(void)
 {
-    uint8_t taskCount = ASch::Scheduler::GetTaskCount();
-    for (uint8_t taskId = 0U; taskId < taskCount; ++taskId)
+    return payloadPool.GetHighWaterMark();
+}
+
+uint32_t Scheduler::GetPayloadAllocationFailureCount(void)
+{
+    return payloadPool.GetFailureCount();
+}
+
+void Scheduler::PushPooledMessage(Message type, payloadHandle_t payload)
+{
+    if ((payload != noPayloadHandle) && (payload <= Config::payloadBlocksMax))
     {
-        if (taskStates[taskId].msCounter > msPerTick)
+        if (type >= Message::invalid)
+        {
+            ReleasePayload(payload);
+            ThrowError(SysError::invalidParameters);
+        }
+        else if (HasMessageListeners(type) == true)
         {
-            taskStates[taskId].msCounter -= msPerTick;
+            eventEntry_t entry;
+            entry.messageType = type;
+            entry.payload = payload;
+            entry.kind = EntryKind::pooledMessage;
+            PushEntry(entry);
         }
         else
         {
-            taskStates[taskId].msCounter = ASch::Scheduler::GetTaskInterval(taskId);
-            taskStates[taskId].isRunning = true;
-            runTasks = true;
+            // Nobody is listening, so the reference of the message is released right away.
+            ReleasePayload(payload);
         }
     }
-
-    if (runTasks == true)
-    {
-        ASch::Scheduler::WakeUp();
-    }
     return;
 }
 
-#if (UNIT_TEST == 1)
-void Scheduler::Deinit(void)
+void Scheduler::StartBackgroundJob(backgroundJob_t Job)
 {
-    taskCount = 0U;
-    eventQueue.Flush();
-    messageListenerCount = 0U;
-    status = SchedulerStatus::idle;
+    if (Job == 0)
+    {
+        ThrowError(SysError::invalidParameters);
+    }
+    else if (backgroundJobCount < Config::backgroundJobsMax)
+    {
+        backgroundJobs[backgroundJobCount] = Job;
+        ++backgroundJobCount;
+    }
+    else
+    {
+        ThrowError(SysError::insufficientResources);
+    }
     return;
 }
-#endif
 
-void Scheduler::ThrowError(SysError error)
+void Scheduler::StopBackgroundJob(backgroundJob_t Job)
+{
+    bool isFound = false;
+    for (backgroundJobIndex_t i = 0U; i < backgroundJobCount; ++i)
+    {
+        if (isFound == false)
+        {
+            isFound = (backgroundJobs[i] == Job);
+            if ((isFound == true) && (i < nextBackgroundJob))
+            {
+                --nextBackgroundJob;
+            }
+        }
+        else
+        {
+            backgroundJobs[i - 1U] = backgroundJobs[i];
+        }
+    }
+
+    if (isFound == true)
+    {
+        --backgroundJobCount;
+        if (nextBackgroundJob >= backgroundJobCount)
+        {
+            nextBackgroundJob = 0U;
+        }
+    }
+    return;
+}
+
+std::size_t Scheduler::GetNumberOfBackgroundJobs(void)
+{
+    return backgroundJobCount;
+}
+
+bool Scheduler::RunBackgroundJobs(void)
+{
+    bool isSliceRun = false;
+    uint32_t startCycles = Hal::System::GetCycleCount();
+
+    // The jobs are preempted at slice boundaries when real-time work is pending or the idle budget is spent.
+    while ((backgroundJobCount > 0U) && (runTasks == false) && (runEvents == false)
+           && ((isSliceRun == false) || ((Hal::System::GetCycleCount() - startCycles) < Config::backgroundCyclesPerIdle)))
+    {
+        backgroundJob_t Job = backgroundJobs[nextBackgroundJob];
+        bool isFinished = Job();
+        isSliceRun = true;
+
+        if (isFinished == true)
+        {
+            StopBackgroundJob(Job);
+        }
+        else
+        {
+            Utils::IncrementIndexWithRollover(nextBackgroundJob, backgroundJobCount);
+        }
+    }
+
+    return isSliceRun;
+}
+
+void Scheduler::MainLoop(void)
+{
+    do
+    {
+        bool isIdle = true;
+        if (runTasks == true)
+        {
+            runTasks = false;
+            Scheduler::RunTasks();
+            isIdle = false;
+        }
+        if (runEvents == true)
+        {
+            runEvents = false;
+            Scheduler::RunEvents();
+            isIdle = false;
+        }
+        if (ActiveObject::Run() == true)
+        {
+            isIdle = false;
+        }
+        if (Fiber::Run() == true)
+        {
+            isIdle = false;
+        }
+
+        // Enter sleep only after one idle run to ensure system is ready to sleep. Idle time is given to background jobs first.
+        if ((isIdle == true) && (Scheduler::RunBackgroundJobs() == false))
+        {
+            Config::Hooks::IdleEnter();
+            Scheduler::Sleep();
+            Config::Hooks::IdleExit();
+        }
+    } while (UNIT_TEST == 0);
+    return;
+}
+
+void Scheduler::TickHandler(void)
+{
+    Config::Hooks::TickStart();
+
+    if ((modeSwitchTicks > 0U) || (pendingScheduleMode != ScheduleMode::invalid))
+    {
+        // The previous task set is frozen at the switch. The main loop applies the mode and catches up the elapsed ticks.
+        if (modeSwitchTicks < 0xFFFFU)
+        {
+            ++modeSwitchTicks;
+        }
+        runTasks = true;
+    }
+    else
+    {
+        for (taskId_t taskId = 0U; taskId < taskCount; ++taskId)
+        {
+            if (CountDownTask(taskId) == true)
+            {
+                // Preemptive tasks are run to completion in the interrupt of their level.
+                Preemption::PostTask(tasks[taskId].level, tasks[taskId].Task);
+            }
+        }
+    }
+
+    if (isElasticModeEnabled == true)
+    {
+        loadWindowMs += msPerTick;
+        if (loadWindowMs >= Config::loadWindowInMs)
+        {
+            // The load is evaluated in the main loop where the busy cycles are counted.
+            loadWindowMs = 0U;
+            isLoadWindowElapsed = true;
+            runTasks = true;
+        }
+    }
+
+    Fiber::Tick(msPerTick);
+
+    if (runTasks == true)
+    {
+        ASch::Scheduler::WakeUp();
+    }
+
+    Config::Hooks::TickEnd();
+    return;
+}
+
+#if (UNIT_TEST == 1)
+void Scheduler::Deinit(void)
+{
+    taskCount = 0U;
+    taskLinkCount = 0U;
+    scheduleMode = ScheduleMode::invalid;
+    pendingScheduleMode = ScheduleMode::invalid;
+    isPendingPhasePreserved = false;
+    modeSwitchTicks = 0U;
+    admissionPolicy = AdmissionPolicy::none;
+    isElasticModeEnabled = false;
+    isOverloaded = false;
+    loadWindowMs = 0U;
+    isLoadWindowElapsed = false;
+    busyCycles = 0UL;
+    load = 0UL;
+    deadlineMissCount = 0UL;
+    windowDeadlineMisses = 0U;
+    eventQueue.Flush();
+    eventOverflowPolicy = EventOverflowPolicy::systemError;
+    EventOverflowHandler = 0;
+    droppedEventCount = 0UL;
+    isEventCoalescingEnabled = false;
+    coalescedEventCount = 0UL;
+    messageListenerCount = 0U;
+    isDispatchingMessage = false;
+    status = SchedulerStatus::idle;
+    payloadPool.Reset();
+    backgroundJobCount = 0U;
+    nextBackgroundJob = 0U;
+    return;
+}
+#endif
+
+void Scheduler::ThrowError(SysError error)
 {
     status = SchedulerStatus::error;
     System::Error(error);
 }
 
+void Scheduler::PushEntry(eventEntry_t const& entry)
+{
+    bool isDropped = false;
+    eventEntry_t droppedEntry;
+
+    Hal::Isr::DisableGlobal();
+    if ((isEventCoalescingEnabled == true) && (eventQueue.Contains(entry, Config::eventCoalescingDepth) == true))
+    {
+        // The pending entry will already be run, so the push is merged into it.
+        ++coalescedEventCount;
+        ReleaseEntryPayload(entry);
+    }
+    else
+    {
+        bool errors = eventQueue.Push(entry);
+
+        if (errors == true)
+        {
+            isDropped = HandleEventOverflow(entry, droppedEntry);
+        }
+
+        if (eventQueue.GetNumberOfElements() > 0U)
+        {
+            runEvents = true;
+            Hal::System::WakeUp();
+        }
+    }
+    Hal::Isr::EnableGlobal();
+
+    if ((isDropped == true) && (EventOverflowHandler != 0))
+    {
+        eventHandler_t DroppedHandler = 0;
+        if ((droppedEntry.kind == EntryKind::event) || (droppedEntry.kind == EntryKind::inlineEvent))
+        {
+            DroppedHandler = droppedEntry.Handler;
+        }
+        EventOverflowHandler({.Handler = DroppedHandler, .pPayload = GetEntryPayload(droppedEntry)});
+    }
+
+    if (isDropped == true)
+    {
+        Hal::Isr::DisableGlobal();
+        ReleaseEntryPayload(droppedEntry);
+        Hal::Isr::EnableGlobal();
+    }
+    return;
+}
+
+void Scheduler::ReleasePayloadReference(payloadHandle_t payload)
+{
+    if ((payload != noPayloadHandle) && (payload <= Config::payloadBlocksMax))
+    {
+        if (payloadReferences[payload - 1U] > 0U)
+        {
+            --payloadReferences[payload - 1U];
+            if (payloadReferences[payload - 1U] == 0U)
+            {
+                (void)payloadPool.Free(payloadPool.GetElement(payload - 1U));
+            }
+        }
+    }
+    return;
+}
+
+const void* Scheduler::GetEntryPayload(eventEntry_t const& entry)
+{
+    const void* pPayload;
+
+    switch (entry.kind)
+    {
+        case EntryKind::inlineEvent:
+            pPayload = entry.inlinePayload.GetData();
+            break;
+
+        case EntryKind::pooledMessage:
+            pPayload = GetPayload(entry.payload);
+            break;
+
+        default:
+            pPayload = entry.pPayload;
+            break;
+    }
+
+    return pPayload;
+}
+
+void Scheduler::ReleaseEntryPayload(eventEntry_t const& entry)
+{
+    if (entry.kind == EntryKind::pooledMessage)
+    {
+        ReleasePayloadReference(entry.payload);
+    }
+    return;
+}
+
+bool Scheduler::HandleEventOverflow(eventEntry_t const& entry, eventEntry_t& droppedEntry)
+{
+    bool isDropped = true;
+
+    switch (eventOverflowPolicy)
+    {
+        case EventOverflowPolicy::dropNewest:
+            droppedEntry = entry;
+            break;
+
+        case EventOverflowPolicy::dropOldest:
+            (void)eventQueue.Pop(droppedEntry);
+            (void)eventQueue.Push(entry);
+            break;
+
+        default:
+            isDropped = false;
+            // The rejected entry is not run, so its payload reference is released here.
+            ReleaseEntryPayload(entry);
+            ThrowError(SysError::insufficientResources);
+            break;
+    }
+
+    if (isDropped == true)
+    {
+        ++droppedEventCount;
+    }
+
+    return isDropped;
+}
+
+bool Scheduler::HasMessageListeners(Message type)
+{
+    bool hasListeners = false;
+
+    if (type < Message::invalid)
+    {
+        hasListeners = (Config::messageRoutes[static_cast<std::size_t>(type)].count > 0U);
+    }
+
+    for (listenerIndex_t i = 0U; (i < messageListenerCount) && (hasListeners == false); ++i)
+    {
+        hasListeners = IsListenerOf(messageListeners[i], type);
+    }
+
+    return hasListeners;
+}
+
+bool Scheduler::IsListenerOf(messageListener_t const& listener, Message type)
+{
+    // Topic-only listeners use Message::invalid as their type, so the type is compared only for typed listeners.
+    bool isListener = (listener.type != Message::invalid) && (listener.type == type);
+
+    if (listener.Handler == 0)
+    {
+        // Unregistered during a dispatch and not removed yet.
+        isListener = false;
+    }
+    else if ((isListener == false) && (type < Message::invalid))
+    {
+        isListener = ((listener.topics & Config::messageTopics[static_cast<std::size_t>(type)]) != 0UL);
+    }
+
+    return isListener;
+}
+
+void Scheduler::DispatchMessage(Message type, const void* pPayload)
+{
+    if (type < Message::invalid)
+    {
+        messageRoute_t const& route = Config::messageRoutes[static_cast<std::size_t>(type)];
+        for (std::size_t i = 0U; i < route.count; ++i)
+        {
+            CallEventHandler(route.pHandlers[i], pPayload);
+        }
+    }
+
+    // The listeners registered by the handlers receive the next message, and the unregistered ones are removed after
+    // the dispatch.
+    const listenerIndex_t listenerCount = messageListenerCount;
+    isDispatchingMessage = true;
+    for (listenerIndex_t i = 0U; i < listenerCount; ++i)
+    {
+        if (IsListenerOf(messageListeners[i], type) == true)
+        {
+            CallEventHandler(messageListeners[i].Handler, pPayload);
+        }
+    }
+    isDispatchingMessage = false;
+    RemoveUnregisteredListeners();
+    return;
+}
+
+void Scheduler::RemoveUnregisteredListeners(void)
+{
+    listenerIndex_t count = 0U;
+    for (listenerIndex_t i = 0U; i < messageListenerCount; ++i)
+    {
+        if (messageListeners[i].Handler != 0)
+        {
+            messageListeners[count] = messageListeners[i];
+            ++count;
+        }
+    }
+    messageListenerCount = count;
+    return;
+}
+
+uint16_t Scheduler::GetEffectiveInterval(taskId_t taskId)
+{
+    uint32_t interval = tasks[taskId].intervalInMs;
+
+    if ((isOverloaded == true) && (tasks[taskId].criticality == TaskCriticality::stretchable))
+    {
+        interval *= Config::elasticStretchFactor;
+        if (interval > 0xFFFFUL)
+        {
+            interval = 0xFFFFUL;
+        }
+    }
+
+    return static_cast<uint16_t>(interval);
+}
+
+void Scheduler::EvaluateLoad(void)
+{
+    Hal::Isr::DisableGlobal();
+    uint8_t misses = windowDeadlineMisses;
+    windowDeadlineMisses = 0U;
+    isLoadWindowElapsed = false;
+    Hal::Isr::EnableGlobal();
+
+    load = static_cast<uint32_t>((static_cast<uint64_t>(busyCycles) * 1000ULL) /
+                                 (static_cast<uint64_t>(Config::loadWindowInMs) * Config::cpuCyclesPerUs));
+    busyCycles = 0UL;
+
+    if ((load >= Config::overloadThreshold) || (misses >= Config::overloadDeadlineMisses))
+    {
+        isOverloaded = true;
+    }
+    else if ((load <= Config::overloadRestoreThreshold) && (misses == 0U))
+    {
+        isOverloaded = false;
+    }
+    return;
+}
+
+uint32_t Scheduler::GetTaskUtilisation(task_t const& task, uint32_t maxCycles)
+{
+    uint32_t utilisation = 0UL;
+
+    if (task.intervalInMs > 0U)
+    {
+        uint64_t wcetInUs = task.wcetInUs;
+        if (wcetInUs == 0UL)
+        {
+            wcetInUs = (static_cast<uint64_t>(maxCycles) + Config::cpuCyclesPerUs - 1UL) / Config::cpuCyclesPerUs;
+        }
+        // The interval is in milliseconds, so the WCET in microseconds is scaled by 1000 to get parts per million.
+        utilisation = static_cast<uint32_t>((wcetInUs * 1000ULL) / task.intervalInMs);
+    }
+
+    return utilisation;
+}
+
+bool Scheduler::IsAdmissible(task_t const& task)
+{
+    bool isAdmissible = false;
+
+    // A task without a declared WCET has no measured run time yet, so the test would count it as free.
+    if ((task.intervalInMs == 0U) || (task.wcetInUs > 0UL))
+    {
+        uint32_t utilisation = GetTaskUtilisation(task, 0UL);
+        std::size_t periodicTaskCount = (task.intervalInMs > 0U) ? 1U : 0U;
+
+        for (taskId_t i = 0U; i < taskCount; ++i)
+        {
+            if ((tasks[i].Task != task.Task) && (tasks[i].intervalInMs > 0U))
+            {
+                utilisation += GetTaskUtilisation(tasks[i], taskStates[i].maxCycles);
+                ++periodicTaskCount;
+            }
+        }
+
+        isAdmissible = (utilisation <= GetUtilisationBound(periodicTaskCount));
+    }
+
+    return isAdmissible;
+}
+
+uint32_t Scheduler::GetUtilisationBound(std::size_t numberOfTasks)
+{
+    // n(2^(1/n) - 1) in parts per million. The bound approaches ln(2) for large task sets.
+    static const uint32_t bounds[] = {1000000UL, 1000000UL, 828427UL, 779763UL, 756828UL, 743492UL, 734772UL, 728627UL,
+                                      724062UL, 720538UL, 717735UL};
+    uint32_t bound = 693147UL;
+
+    if (numberOfTasks < (sizeof(bounds) / sizeof(bounds[0])))
+    {
+        bound = bounds[numberOfTasks];
+    }
+
+    return bound;
+}
+
+void Scheduler::ApplyScheduleMode(uint16_t levelActivations[])
+{
+    scheduleMode_t const& mode = Config::scheduleModes[static_cast<std::size_t>(pendingScheduleMode)];
+    taskState_t modeTaskStates[Config::schedulerTasksMax];
+
+    // The states are resolved against the previous task set before it is overwritten.
+    for (taskId_t i = 0U; i < mode.count; ++i)
+    {
+        taskId_t previousId = GetTaskId(mode.pTasks[i].Task);
+        modeTaskStates[i] = {.msCounter = mode.pTasks[i].intervalInMs, .isRunning = false, .maxCycles = 0UL};
+
+        if (previousId < taskCount)
+        {
+            modeTaskStates[i].maxCycles = taskStates[previousId].maxCycles;
+            if (isPendingPhasePreserved == true)
+            {
+                modeTaskStates[i].isRunning = taskStates[previousId].isRunning;
+                if (taskStates[previousId].msCounter < modeTaskStates[i].msCounter)
+                {
+                    modeTaskStates[i].msCounter = taskStates[previousId].msCounter;
+                }
+            }
+        }
+    }
+
+    for (taskId_t i = 0U; i < mode.count; ++i)
+    {
+        tasks[i] = mode.pTasks[i];
+        taskStates[i] = modeTaskStates[i];
+    }
+    taskCount = static_cast<taskId_t>(mode.count);
+
+    taskLinkIndex_t linkCount = 0U;
+    for (taskLinkIndex_t i = 0U; i < taskLinkCount; ++i)
+    {
+        if ((GetTaskId(taskLinks[i].Predecessor) < taskCount) && (GetTaskId(taskLinks[i].Successor) < taskCount))
+        {
+            taskLinks[linkCount] = taskLinks[i];
+            ++linkCount;
+        }
+    }
+    taskLinkCount = linkCount;
+
+    // The ticks that elapsed since the switch are counted against the new task set.
+    for (uint16_t tick = 0U; tick < modeSwitchTicks; ++tick)
+    {
+        for (taskId_t i = 0U; i < taskCount; ++i)
+        {
+            if (CountDownTask(i) == true)
+            {
+                ++levelActivations[i];
+            }
+        }
+    }
+
+    scheduleMode = pendingScheduleMode;
+    pendingScheduleMode = ScheduleMode::invalid;
+    modeSwitchTicks = 0U;
+    return;
+}
+
+bool Scheduler::CountDownTask(taskId_t taskId)
+{
+    bool isLevelTaskDue = false;
+
+    if (tasks[taskId].intervalInMs == 0U)
+    {
+        // Pipeline stages are released only by their predecessors.
+    }
+    else if (taskStates[taskId].msCounter > msPerTick)
+    {
+        taskStates[taskId].msCounter -= msPerTick;
+    }
+    else
+    {
+        taskStates[taskId].msCounter = GetEffectiveInterval(taskId);
+        if ((isOverloaded == true) && (tasks[taskId].criticality == TaskCriticality::sheddable))
+        {
+            // Sheddable tasks are suspended during overload.
+        }
+        else if (tasks[taskId].level > 0U)
+        {
+            isLevelTaskDue = true;
+        }
+        else
+        {
+            if ((isElasticModeEnabled == true) && (taskStates[taskId].isRunning == true))
+            {
+                // The previous activation has not been run yet.
+                ++deadlineMissCount;
+                if (windowDeadlineMisses < 0xFFU)
+                {
+                    ++windowDeadlineMisses;
+                }
+            }
+            taskStates[taskId].isRunning = true;
+            runTasks = true;
+        }
+    }
+    return isLevelTaskDue;
+}
+
+taskId_t Scheduler::GetTaskId(taskHandler_t Task)
+{
+    taskId_t taskId = taskCount;
+    for (taskId_t i = 0U; (i < taskCount) && (taskId == taskCount); ++i)
+    {
+        if (tasks[i].Task == Task)
+        {
+            taskId = i;
+        }
+    }
+    return taskId;
+}
+
+bool Scheduler::ReleaseSuccessors(taskHandler_t Predecessor)
+{
+    bool isReleased = false;
+
+    for (taskLinkIndex_t i = 0U; i < taskLinkCount; ++i)
+    {
+        if (taskLinks[i].Predecessor == Predecessor)
+        {
+            taskLinks[i].isDone = true;
+
+            // Join: the successor is released only when all its links are done.
+            bool isJoined = true;
+            for (taskLinkIndex_t j = 0U; j < taskLinkCount; ++j)
+            {
+                if ((taskLinks[j].Successor == taskLinks[i].Successor) && (taskLinks[j].isDone == false))
+                {
+                    isJoined = false;
+                }
+            }
+
+            if (isJoined == true)
+            {
+                for (taskLinkIndex_t j = 0U; j < taskLinkCount; ++j)
+                {
+                    if (taskLinks[j].Successor == taskLinks[i].Successor)
+                    {
+                        taskLinks[j].isDone = false;
+                    }
+                }
+                taskId_t successorId = GetTaskId(taskLinks[i].Successor);
+                if (successorId < taskCount)
+                {
+                    taskStates[successorId].isRunning = true;
+                    isReleased = true;
+                }
+            }
+        }
+    }
+
+    return isReleased;
+}
+
+bool Scheduler::IsTaskReachable(taskHandler_t From, taskHandler_t To)
+{
+    bool isReachable = (From == To);
+    bool isVisited[Config::schedulerTaskLinksMax] = {false};
+    taskHandler_t reached[Config::schedulerTaskLinksMax + 1U];
+    std::size_t reachedCount = 1U;
+
+    // Every link is followed at most once, so the search ends within the link count.
+    reached[0] = From;
+    for (std::size_t next = 0U; (next < reachedCount) && (isReachable == false); ++next)
+    {
+        for (taskLinkIndex_t i = 0U; (i < taskLinkCount) && (isReachable == false); ++i)
+        {
+            if ((isVisited[i] == false) && (taskLinks[i].Predecessor == reached[next]))
+            {
+                isVisited[i] = true;
+                isReachable = (taskLinks[i].Successor == To);
+                reached[reachedCount] = taskLinks[i].Successor;
+                ++reachedCount;
+            }
+        }
+    }
+
+    return isReachable;
+}
+
+void Scheduler::RemoveTaskLinks(taskHandler_t Task)
+{
+    taskLinkIndex_t linkCount = 0U;
+    for (taskLinkIndex_t i = 0U; i < taskLinkCount; ++i)
+    {
+        if ((taskLinks[i].Predecessor != Task) && (taskLinks[i].Successor != Task))
+        {
+            taskLinks[linkCount] = taskLinks[i];
+            ++linkCount;
+        }
+    }
+    taskLinkCount = linkCount;
+    return;
+}
+
+void Scheduler::CallEventHandler(eventHandler_t Handler, const void* pPayload)
+{
+    Config::Hooks::EventStart(Handler);
+    Handler(pPayload);
+    Config::Hooks::EventEnd(Handler);
+    return;
+}
+
+bool Scheduler::IsEventPassSpent(std::size_t eventsInPass, uint32_t passStartCycles)
+{
+    bool isSpent = false;
+
+    if ((Config::schedulerEventsPerPass > 0U) && (eventsInPass >= Config::schedulerEventsPerPass))
+    {
+        isSpent = true;
+    }
+    else if ((Config::schedulerEventCyclesPerPass > 0UL)
+             && ((Hal::System::GetCycleCount() - passStartCycles) >= Config::schedulerEventCyclesPerPass))
+    {
+        isSpent = true;
+    }
+
+    return isSpent;
+}
+
 } // namespace ASch
 
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,284 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    ASch_StateMachine.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   StateMachine
+//! @brief   This is the hierarchical state machine engine of ASch.
+//! 
+//! The transitions are found with a binary search over the sorted transition table, so the lookup cost grows only
+//! logarithmically with the table size and does not depend on how the cases would have been nested in a switch.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <ASch_StateMachine.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Local Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 6. Class Member Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace ASch
+{
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+void StateMachine::Start(stateId_t initialState)
+{
+    if (initialState >= stateCount)
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else
+    {
+        currentState = noState;
+        EnterFrom(noState, initialState, 0);
+    }
+    return;
+}
+
+bool StateMachine::Dispatch(hsmSignal_t signal, const void* pPayload)
+{
+    bool isHandled = false;
+
+    for (stateId_t state = currentState; (state != noState) && (isHandled == false); state = pStates[state].parent)
+    {
+        const hsmTransition_t* pTransition = FindTransition(state, signal, pPayload);
+
+        if (pTransition != 0)
+        {
+            Transit(state, *pTransition, pPayload);
+            isHandled = true;
+        }
+    }
+
+    return isHandled;
+}
+
+stateId_t StateMachine::GetState(void) const
+{
+    return currentState;
+}
+
+bool StateMachine::IsIn(stateId_t state) const
+{
+    bool isIn = false;
+
+    for (stateId_t activeState = currentState; (activeState != noState) && (isIn == false); activeState = pStates[activeState].parent)
+    {
+        isIn = (activeState == state);
+    }
+
+    return isIn;
+}
+
+const hsmTransition_t* StateMachine::FindTransition(stateId_t state, hsmSignal_t signal, const void* pPayload) const
+{
+    const hsmTransition_t* pTransition = 0;
+    const uint32_t key = GetKey(state, signal);
+    std::size_t low = 0U;
+    std::size_t high = transitionCount;
+
+    // Find the first transition with the key.
+    while (low < high)
+    {
+        std::size_t middle = low + ((high - low) / 2U);
+
+        if (GetKey(pTransitions[middle].source, pTransitions[middle].signal) < key)
+        {
+            low = middle + 1U;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    for (std::size_t i = low; (i < transitionCount) && (pTransition == 0) &&
+                              (GetKey(pTransitions[i].source, pTransitions[i].signal) == key); ++i)
+    {
+        if ((pTransitions[i].Guard == 0) || (pTransitions[i].Guard(pPayload) == true))
+        {
+            pTransition = &pTransitions[i];
+        }
+    }
+
+    return pTransition;
+}
+
+void StateMachine::Transit(stateId_t source, hsmTransition_t const& transition, const void* pPayload)
+{
+    if (transition.target == noState)
+    {
+        if (transition.Action != 0)
+        {
+            transition.Action(pPayload);
+        }
+    }
+    else if (transition.target >= stateCount)
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else
+    {
+        stateId_t ancestor = FindCommonAncestor(source, transition.target);
+
+        ExitTo(ancestor, pPayload);
+        if (transition.Action != 0)
+        {
+            transition.Action(pPayload);
+        }
+        EnterFrom(ancestor, transition.target, pPayload);
+    }
+    return;
+}
+
+stateId_t StateMachine::FindCommonAncestor(stateId_t source, stateId_t target) const
+{
+    stateId_t sourceAncestor = source;
+    stateId_t targetAncestor = target;
+    std::size_t sourceDepth = GetDepth(source);
+    std::size_t targetDepth = GetDepth(target);
+
+    while (sourceDepth > targetDepth)
+    {
+        sourceAncestor = pStates[sourceAncestor].parent;
+        --sourceDepth;
+    }
+    while (targetDepth > sourceDepth)
+    {
+        targetAncestor = pStates[targetAncestor].parent;
+        --targetDepth;
+    }
+    while (sourceAncestor != targetAncestor)
+    {
+        sourceAncestor = pStates[sourceAncestor].parent;
+        targetAncestor = pStates[targetAncestor].parent;
+    }
+
+    // A target that is the source or its ancestor is exited and entered again.
+    if (sourceAncestor == target)
+    {
+        sourceAncestor = pStates[target].parent;
+    }
+
+    return sourceAncestor;
+}
+
+std::size_t StateMachine::GetDepth(stateId_t state) const
+{
+    std::size_t depth = 0U;
+
+    for (stateId_t ancestor = state; ancestor != noState; ancestor = pStates[ancestor].parent)
+    {
+        ++depth;
+    }
+
+    return depth;
+}
+
+void StateMachine::ExitTo(stateId_t ancestor, const void* pPayload)
+{
+    while ((currentState != ancestor) && (currentState != noState))
+    {
+        if (pStates[currentState].Exit != 0)
+        {
+            pStates[currentState].Exit(pPayload);
+        }
+        currentState = pStates[currentState].parent;
+    }
+    return;
+}
+
+void StateMachine::EnterFrom(stateId_t ancestor, stateId_t target, const void* pPayload)
+{
+    stateId_t path[hsmDepthMax];
+    std::size_t depth = 0U;
+    bool errors = false;
+
+    for (stateId_t state = target; (state != ancestor) && (state != noState) && (errors == false); state = pStates[state].parent)
+    {
+        if (depth < hsmDepthMax)
+        {
+            path[depth] = state;
+            ++depth;
+        }
+        else
+        {
+            errors = true;
+        }
+    }
+
+    if (errors == true)
+    {
+        System::Error(SysError::invalidParameters);
+    }
+    else
+    {
+        while (depth > 0U)
+        {
+            --depth;
+            currentState = path[depth];
+            if (pStates[currentState].Entry != 0)
+            {
+                pStates[currentState].Entry(pPayload);
+            }
+        }
+
+        while (pStates[currentState].initial != noState)
+        {
+            currentState = pStates[currentState].initial;
+            if (pStates[currentState].Entry != 0)
+            {
+                pStates[currentState].Entry(pPayload);
+            }
+        }
+    }
+    return;
+}
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 7. Global Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 8. Static Functions
+//-----------------------------------------------------------------------------------------------------------------------------
@@ -36,6 +36,8 @@
 
 #include <ASch_System.hpp>
 #include <ASch_Scheduler.hpp>
+#include <ASch_ActiveObject.hpp>
+#include <ASch_Preemption.hpp>
 #include <ASch_Configuration.hpp>
 #include <Hal_System.hpp>
 
@@ -93,8 +95,11 @@ void System::EnableResetOnSystemError(void)
 void System::Init(void)
 {
     Hal::System::InitPowerControl();
+    Hal::System::InitCycleCounter();
     
     Scheduler::Init(Config::schedulerTickInterval);
+    ActiveObject::Init();
+    Preemption::Init();
     return;
 }
 
@@ -0,0 +1,271 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_ASch_ActiveObject.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for ASch_ActiveObject.cpp
+//! 
+//! These are unit tests for ASch_ActiveObject.cpp utilising Catch2 and FakeIt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Catch_Utils.hpp>
+
+#include <ASch_ActiveObject.hpp>
+
+#include <ASch_System_Mock.hpp>
+#include <Hal_Isr_Mock.hpp>
+#include <Hal_System_Mock.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+static char dispatchLog[8] = {0};
+static std::size_t dispatchLogLength = 0U;
+
+static ASch::aoEvent_t lowQueue[2];
+static ASch::aoEvent_t highQueue[3];
+
+static void Log(char entry)
+{
+    if (dispatchLogLength < (sizeof(dispatchLog) - 1U))
+    {
+        dispatchLog[dispatchLogLength] = entry;
+        ++dispatchLogLength;
+    }
+    return;
+}
+
+// ---------- Test dispatchers ----------
+static void LowDispatcher(ASch::aoEvent_t const& event)
+{
+    Log(static_cast<char>('a' + event.signal));
+    return;
+}
+
+static void HighDispatcher(ASch::aoEvent_t const& event)
+{
+    Log(static_cast<char>('A' + event.signal));
+    return;
+}
+
+static void InitDispatchLog(void)
+{
+    for (std::size_t i = 0U; i < sizeof(dispatchLog); ++i)
+    {
+        dispatchLog[i] = 0;
+    }
+    dispatchLogLength = 0U;
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+// This scenario must stay first, since it relies on the module state that is zero-initialised at startup.
+SCENARIO ("Developer creates an active object without initialising the module", "[active_object]")
+{
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitDispatchLog();
+
+    GIVEN ("the module has not been initialised")
+    {
+        WHEN ("an active object is created and an event is posted to it")
+        {
+            ASch::activeObjectId_t object = ASch::ActiveObject::Create(LowDispatcher, 0U, lowQueue);
+            bool errors = ASch::ActiveObject::Post(object, {.signal = 2U, .pPayload = 0});
+            bool isDispatched = ASch::ActiveObject::Run();
+
+            THEN ("the object shall be created and the event shall be dispatched without a system error")
+            {
+                REQUIRE (object == 0U);
+                REQUIRE (errors == false);
+                REQUIRE (isDispatched == true);
+                REQUIRE (std::string(dispatchLog) == "c");
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer posts events to active objects", "[active_object]")
+{
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitDispatchLog();
+    ASch::ActiveObject::Deinit();
+
+    GIVEN ("a low and a high priority active object are created")
+    {
+        ASch::activeObjectId_t low = ASch::ActiveObject::Create(LowDispatcher, 1U, lowQueue);
+        ASch::activeObjectId_t high = ASch::ActiveObject::Create(HighDispatcher, 20U, highQueue);
+
+        WHEN ("no events are posted and the objects are run")
+        {
+            bool isDispatched = ASch::ActiveObject::Run();
+
+            THEN ("nothing shall be dispatched")
+            {
+                REQUIRE (low == 0U);
+                REQUIRE (high == 1U);
+                REQUIRE (isDispatched == false);
+            }
+        }
+
+        WHEN ("events are posted to both objects")
+        {
+            bool errors = ASch::ActiveObject::Post(low, {.signal = 0U, .pPayload = 0});
+            errors |= ASch::ActiveObject::Post(low, {.signal = 1U, .pPayload = 0});
+            errors |= ASch::ActiveObject::Post(high, {.signal = 0U, .pPayload = 0});
+            errors |= ASch::ActiveObject::Post(high, {.signal = 1U, .pPayload = 0});
+
+            THEN ("the events shall be queued to the objects and the system shall be woken up")
+            {
+                REQUIRE (errors == false);
+                REQUIRE (ASch::ActiveObject::GetNumberOfEvents(low) == 2U);
+                REQUIRE (ASch::ActiveObject::GetNumberOfEvents(high) == 2U);
+                REQUIRE_CALLS (4, HalMock::mockHalSystem, WakeUp);
+            }
+            AND_WHEN ("the objects are run once")
+            {
+                bool isDispatched = ASch::ActiveObject::Run();
+
+                THEN ("only one event of the high priority object shall be dispatched")
+                {
+                    REQUIRE (isDispatched == true);
+                    REQUIRE (std::string(dispatchLog) == "A");
+                    REQUIRE (ASch::ActiveObject::GetNumberOfEvents(high) == 1U);
+                }
+                AND_WHEN ("the objects are run until there are no events")
+                {
+                    while (ASch::ActiveObject::Run() == true) {}
+
+                    THEN ("the high priority events shall be dispatched first, each object in FIFO order")
+                    {
+                        REQUIRE (std::string(dispatchLog) == "ABab");
+                        REQUIRE (ASch::ActiveObject::GetNumberOfEvents(low) == 0U);
+                    }
+                }
+            }
+        }
+
+        WHEN ("the queue of the low priority object is flooded")
+        {
+            (void)ASch::ActiveObject::Post(low, {.signal = 0U, .pPayload = 0});
+            (void)ASch::ActiveObject::Post(low, {.signal = 1U, .pPayload = 0});
+            bool lowErrors = ASch::ActiveObject::Post(low, {.signal = 2U, .pPayload = 0});
+            bool highErrors = ASch::ActiveObject::Post(high, {.signal = 2U, .pPayload = 0});
+
+            THEN ("only the events to the flooded object shall be dropped")
+            {
+                REQUIRE (lowErrors == true);
+                REQUIRE (highErrors == false);
+                REQUIRE (ASch::ActiveObject::GetDroppedEventCount(low) == 1UL);
+                REQUIRE (ASch::ActiveObject::GetDroppedEventCount(high) == 0UL);
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+            }
+            AND_WHEN ("one event is dispatched from the flooded object and a new one is posted")
+            {
+                (void)ASch::ActiveObject::Run();
+                (void)ASch::ActiveObject::Run();
+                (void)ASch::ActiveObject::Post(low, {.signal = 3U, .pPayload = 0});
+                while (ASch::ActiveObject::Run() == true) {}
+
+                THEN ("the queue shall roll over and keep the FIFO order")
+                {
+                    REQUIRE (std::string(dispatchLog) == "Cabd");
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer uses active objects wrong", "[active_object]")
+{
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitDispatchLog();
+    ASch::ActiveObject::Deinit();
+
+    GIVEN ("the active object module is initialised")
+    {
+        WHEN ("developer creates two objects with the same priority")
+        {
+            (void)ASch::ActiveObject::Create(LowDispatcher, 3U, lowQueue);
+            ASch::activeObjectId_t object = ASch::ActiveObject::Create(HighDispatcher, 3U, highQueue);
+
+            THEN ("a system error shall occur and the second object shall not be created")
+            {
+                REQUIRE (object == ASch::invalidActiveObjectId);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+
+        WHEN ("developer creates an object with too high priority")
+        {
+            ASch::activeObjectId_t object = ASch::ActiveObject::Create(LowDispatcher, ASch::activeObjectPrioritiesMax, lowQueue);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE (object == ASch::invalidActiveObjectId);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+
+        WHEN ("developer creates more objects than there are slots")
+        {
+            for (uint8_t i = 0U; i < ASch::Config::activeObjectsMax; ++i)
+            {
+                (void)ASch::ActiveObject::Create(LowDispatcher, i, lowQueue);
+            }
+            ASch::activeObjectId_t object = ASch::ActiveObject::Create(LowDispatcher, 31U, lowQueue);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE (object == ASch::invalidActiveObjectId);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+            }
+        }
+
+        WHEN ("developer posts an event to an object that does not exist")
+        {
+            bool errors = ASch::ActiveObject::Post(0U, {.signal = 0U, .pPayload = 0});
+
+            THEN ("a system error shall occur and the event shall be rejected")
+            {
+                REQUIRE (errors == true);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+    }
+}
@@ -0,0 +1,218 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_ASch_Arena.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for ASch_Arena.cpp
+//! 
+//! These are unit tests for ASch_Arena.cpp utilising Catch2 and FakeIt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Catch_Utils.hpp>
+#include <string>
+
+#include <ASch_Arena.hpp>
+
+#include <ASch_System_Mock.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+// A configuration structure that is sized at boot.
+class TestConfig
+{
+public:
+    TestConfig(uint16_t value) : number(value), isValid(true) {};
+
+    uint16_t number;
+    bool isValid;
+};
+
+// A structure that takes its constructor argument by value, so an rvalue argument would be moved from.
+class TestName
+{
+public:
+    TestName(std::string name) : length(name.size()) {};
+
+    std::size_t length;
+};
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer allocates memory from the init-phase arena", "[arena]")
+{
+    ASchMock::InitSystem();
+    ASch::Arena::Deinit();
+
+    GIVEN ("the arena is empty")
+    {
+        THEN ("all of it shall be free")
+        {
+            REQUIRE (ASch::Arena::GetFree() == ASch::Config::arenaSize);
+            REQUIRE (ASch::Arena::GetTotalUsage() == 0U);
+            REQUIRE (ASch::Arena::IsSealed() == false);
+        }
+
+        WHEN ("two owners allocate memory")
+        {
+            uint8_t* pBytes = static_cast<uint8_t*>(ASch::Arena::Allocate(ASch::ArenaOwner::test_0, 3U, 1U));
+            uint32_t* pWords = static_cast<uint32_t*>(ASch::Arena::Allocate(ASch::ArenaOwner::test_1, 8U, 4U));
+
+            THEN ("the memory shall be aligned and not overlap")
+            {
+                REQUIRE (pBytes != 0);
+                REQUIRE (pWords != 0);
+                REQUIRE ((reinterpret_cast<uintptr_t>(pWords) % 4U) == 0U);
+                REQUIRE (reinterpret_cast<uint8_t*>(pWords) >= (pBytes + 3U));
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+            }
+            AND_THEN ("the usage shall be reported per owner, including the alignment padding")
+            {
+                REQUIRE (ASch::Arena::GetUsage(ASch::ArenaOwner::test_0) == 3U);
+                REQUIRE (ASch::Arena::GetUsage(ASch::ArenaOwner::test_1) >= 8U);
+                REQUIRE (ASch::Arena::GetTotalUsage() ==
+                         (ASch::Arena::GetUsage(ASch::ArenaOwner::test_0) + ASch::Arena::GetUsage(ASch::ArenaOwner::test_1)));
+                REQUIRE (ASch::Arena::GetFree() == (ASch::Config::arenaSize - ASch::Arena::GetTotalUsage()));
+            }
+        }
+
+        WHEN ("an array of objects is created")
+        {
+            TestConfig* pConfigs = ASch::Arena::Create<TestConfig>(ASch::ArenaOwner::test_0, 3U, 7U);
+
+            THEN ("the objects shall be constructed")
+            {
+                REQUIRE (pConfigs != 0);
+                REQUIRE (pConfigs[2].number == 7U);
+                REQUIRE (pConfigs[2].isValid == true);
+                REQUIRE (ASch::Arena::GetUsage(ASch::ArenaOwner::test_0) == (3U * sizeof(TestConfig)));
+            }
+        }
+
+        WHEN ("an array of objects is created from an rvalue argument")
+        {
+            TestName* pNames = ASch::Arena::Create<TestName>(ASch::ArenaOwner::test_0, 2U, std::string("name"));
+
+            THEN ("every object shall be constructed from the original value")
+            {
+                REQUIRE (pNames != 0);
+                REQUIRE (pNames[0].length == 4U);
+                REQUIRE (pNames[1].length == 4U);
+            }
+        }
+
+        WHEN ("an array of objects larger than the address space is created")
+        {
+            TestConfig* pConfigs = ASch::Arena::Create<TestConfig>(ASch::ArenaOwner::test_0, (SIZE_MAX / sizeof(TestConfig)) + 1U, 7U);
+
+            THEN ("the creation shall fail with a system error")
+            {
+                REQUIRE (pConfigs == 0);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+                REQUIRE (ASch::Arena::GetTotalUsage() == 0U);
+            }
+        }
+
+        WHEN ("more memory than the arena has is allocated")
+        {
+            void* pMemory = ASch::Arena::Allocate(ASch::ArenaOwner::test_0, ASch::Config::arenaSize + 1U, 1U);
+
+            THEN ("the allocation shall fail with a system error")
+            {
+                REQUIRE (pMemory == 0);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+                REQUIRE (ASch::Arena::GetTotalUsage() == 0U);
+            }
+        }
+
+        WHEN ("the whole arena is allocated")
+        {
+            void* pMemory = ASch::Arena::Allocate(ASch::ArenaOwner::test_1, ASch::Config::arenaSize, 1U);
+
+            THEN ("it shall succeed and no memory shall be left")
+            {
+                REQUIRE (pMemory != 0);
+                REQUIRE (ASch::Arena::GetFree() == 0U);
+            }
+            AND_WHEN ("one more byte is allocated")
+            {
+                pMemory = ASch::Arena::Allocate(ASch::ArenaOwner::test_1, 1U, 1U);
+
+                THEN ("the allocation shall fail with a system error")
+                {
+                    REQUIRE (pMemory == 0);
+                    REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+                }
+            }
+        }
+
+        WHEN ("memory is allocated with invalid parameters")
+        {
+            void* pInvalidOwner = ASch::Arena::Allocate(ASch::ArenaOwner::invalid, 4U, 4U);
+            void* pZeroSize = ASch::Arena::Allocate(ASch::ArenaOwner::test_0, 0U, 4U);
+            void* pBadAlignment = ASch::Arena::Allocate(ASch::ArenaOwner::test_0, 4U, 3U);
+
+            THEN ("the allocations shall fail with system errors")
+            {
+                REQUIRE (pInvalidOwner == 0);
+                REQUIRE (pZeroSize == 0);
+                REQUIRE (pBadAlignment == 0);
+                REQUIRE_PARAM_CALLS (3, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+                REQUIRE (ASch::Arena::GetUsage(ASch::ArenaOwner::invalid) == 0U);
+            }
+        }
+    }
+
+    GIVEN ("memory is allocated and the arena is sealed")
+    {
+        void* pMemory = ASch::Arena::Allocate(ASch::ArenaOwner::test_0, 4U, 4U);
+        ASch::Arena::Seal();
+
+        WHEN ("more memory is allocated")
+        {
+            void* pSealed = ASch::Arena::Allocate(ASch::ArenaOwner::test_0, 4U, 4U);
+
+            THEN ("the allocation shall fail with a system error")
+            {
+                REQUIRE (pMemory != 0);
+                REQUIRE (pSealed == 0);
+                REQUIRE (ASch::Arena::IsSealed() == true);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::accessNotPermitted);
+            }
+            AND_THEN ("the usage report shall not change")
+            {
+                REQUIRE (ASch::Arena::GetUsage(ASch::ArenaOwner::test_0) == 4U);
+                REQUIRE (ASch::Arena::GetTotalUsage() == 4U);
+            }
+        }
+    }
+}
@@ -0,0 +1,213 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_ASch_Domain.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for ASch_Domain.cpp
+//! 
+//! These are unit tests for ASch_Domain.cpp utilising Catch2 and FakeIt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Catch_Utils.hpp>
+
+#include <ASch_Domain.hpp>
+
+#include <ASch_System_Mock.hpp>
+#include <Hal_Isr_Mock.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+static uint8_t taskCalls[3] = {0U};
+static uint8_t eventCalls[2] = {0U};
+
+static void FastTask(void)
+{
+    ++taskCalls[0];
+    return;
+}
+
+static void SlowTask(void)
+{
+    ++taskCalls[1];
+    return;
+}
+
+static void OtherTask(void)
+{
+    ++taskCalls[2];
+    return;
+}
+
+static void FastEventHandler(const void* pPayload)
+{
+    (void)pPayload;
+    ++eventCalls[0];
+    return;
+}
+
+static void SlowEventHandler(const void* pPayload)
+{
+    (void)pPayload;
+    ++eventCalls[1];
+    return;
+}
+
+static void InitCallCounters(void)
+{
+    for (std::size_t i = 0U; i < 3U; ++i)
+    {
+        taskCalls[i] = 0U;
+    }
+    for (std::size_t i = 0U; i < 2U; ++i)
+    {
+        eventCalls[i] = 0U;
+    }
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer runs independent scheduler domains", "[domain]")
+{
+    HalMock::InitIsr();
+    ASchMock::InitSystem();
+    InitCallCounters();
+
+    static ASch::domainTask_t fastTasks[2];
+    static ASch::event_t fastEvents[2];
+    static ASch::domainTask_t slowTasks[1];
+    static ASch::event_t slowEvents[3];
+
+    GIVEN ("a 1 ms domain with a task of 1 ms and a 10 ms domain with a task of 20 ms")
+    {
+        ASch::Domain fast(1U, fastTasks, fastEvents);
+        ASch::Domain slow(10U, slowTasks, slowEvents);
+        fast.CreateTask({.intervalInMs = 1U, .Task = FastTask});
+        slow.CreateTask({.intervalInMs = 20U, .Task = SlowTask});
+
+        WHEN ("the domains are run before any tick")
+        {
+            bool isRun = fast.Run() || slow.Run();
+
+            THEN ("nothing shall be run")
+            {
+                REQUIRE (isRun == false);
+            }
+        }
+
+        WHEN ("both domains are ticked and run twice")
+        {
+            for (uint8_t i = 0U; i < 2U; ++i)
+            {
+                fast.Tick();
+                (void)fast.Run();
+                slow.Tick();
+                (void)slow.Run();
+            }
+
+            THEN ("each task shall run at the rate of its own domain")
+            {
+                REQUIRE (fast.GetTaskCount() == 1U);
+                REQUIRE (slow.GetTaskCount() == 1U);
+                REQUIRE (taskCalls[0] == 2U);
+                REQUIRE (taskCalls[1] == 1U);
+            }
+        }
+
+        WHEN ("events are pushed to both domains and only the slow domain is run")
+        {
+            fast.PushEvent({.Handler = FastEventHandler, .pPayload = 0});
+            fast.PushEvent({.Handler = FastEventHandler, .pPayload = 0});
+            slow.PushEvent({.Handler = SlowEventHandler, .pPayload = 0});
+            bool isRun = slow.Run();
+
+            THEN ("only the events of the slow domain shall be run")
+            {
+                REQUIRE (isRun == true);
+                REQUIRE (eventCalls[0] == 0U);
+                REQUIRE (eventCalls[1] == 1U);
+                REQUIRE (fast.GetNumberOfEvents() == 2U);
+                REQUIRE (slow.GetNumberOfEvents() == 0U);
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+            }
+            AND_WHEN ("the fast domain is run and three more events are pushed to it")
+            {
+                (void)fast.Run();
+                fast.PushEvent({.Handler = FastEventHandler, .pPayload = 0});
+                fast.PushEvent({.Handler = FastEventHandler, .pPayload = 0});
+                fast.PushEvent({.Handler = FastEventHandler, .pPayload = 0});
+
+                THEN ("the overflow of its own queue shall cause a system error")
+                {
+                    REQUIRE (eventCalls[0] == 2U);
+                    REQUIRE (fast.GetNumberOfEvents() == 2U);
+                    REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+                }
+            }
+        }
+
+        WHEN ("a task is deleted from the fast domain and the domains are ticked and run")
+        {
+            fast.DeleteTask(FastTask);
+            fast.Tick();
+            (void)fast.Run();
+
+            THEN ("the task shall not be run")
+            {
+                REQUIRE (fast.GetTaskCount() == 0U);
+                REQUIRE (taskCalls[0] == 0U);
+            }
+        }
+
+        WHEN ("more tasks than fit are created in the slow domain")
+        {
+            slow.CreateTask({.intervalInMs = 20U, .Task = OtherTask});
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE (slow.GetTaskCount() == 1U);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+            }
+        }
+
+        WHEN ("a task with zero interval is created")
+        {
+            fast.CreateTask({.intervalInMs = 0U, .Task = OtherTask});
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE (fast.GetTaskCount() == 1U);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+    }
+}
@@ -0,0 +1,280 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_ASch_Fiber.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for ASch_Fiber.cpp
+//! 
+//! These are unit tests for ASch_Fiber.cpp utilising Catch2 and FakeIt. The fibers are switched with the host
+//! implementation of HAL Context.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Catch_Utils.hpp>
+
+#include <ASch_Fiber.hpp>
+
+#include <ASch_System_Mock.hpp>
+#include <Hal_Isr_Mock.hpp>
+#include <Hal_System_Mock.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+static char fiberLog[8] = {0};
+static std::size_t fiberLogLength = 0U;
+static uint32_t receivedEvents = 0UL;
+static ASch::fiberId_t fiberIdInFiber = ASch::invalidFiberId;
+
+static void Log(char entry)
+{
+    if (fiberLogLength < (sizeof(fiberLog) - 1U))
+    {
+        fiberLog[fiberLogLength] = entry;
+        ++fiberLogLength;
+    }
+    return;
+}
+
+// ---------- Test fibers ----------
+static void DelayingFiber(void)
+{
+    fiberIdInFiber = ASch::Fiber::GetCurrent();
+    Log('1');
+    ASch::Fiber::Delay(3UL);
+    Log('2');
+    ASch::Fiber::Delay(0UL);
+    Log('3');
+    return;
+}
+
+static void WaitingFiber(void)
+{
+    Log('W');
+    receivedEvents = ASch::Fiber::Wait(0x6UL);
+    Log('w');
+    return;
+}
+
+static void FiberA(void)
+{
+    Log('A');
+    ASch::Fiber::Delay(0UL);
+    Log('a');
+    return;
+}
+
+static void FiberB(void)
+{
+    Log('B');
+    ASch::Fiber::Delay(0UL);
+    Log('b');
+    return;
+}
+
+static void InitFiberLog(void)
+{
+    for (std::size_t i = 0U; i < sizeof(fiberLog); ++i)
+    {
+        fiberLog[i] = 0;
+    }
+    fiberLogLength = 0U;
+    receivedEvents = 0UL;
+    fiberIdInFiber = ASch::invalidFiberId;
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer delays a fiber", "[fiber]")
+{
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitFiberLog();
+    ASch::Fiber::Deinit();
+
+    GIVEN ("a fiber that delays itself is created")
+    {
+        ASch::fiberId_t fiber = ASch::Fiber::Create(DelayingFiber);
+
+        WHEN ("the main loop runs the fibers")
+        {
+            bool isFiberRun = ASch::Fiber::Run();
+
+            THEN ("the fiber shall run until its delay")
+            {
+                REQUIRE (fiber == 0U);
+                REQUIRE (isFiberRun == true);
+                REQUIRE (std::string(fiberLog) == "1");
+                REQUIRE (fiberIdInFiber == fiber);
+                REQUIRE (ASch::Fiber::GetCurrent() == ASch::invalidFiberId);
+            }
+            AND_WHEN ("the fibers are run again before the delay has elapsed")
+            {
+                ASch::Fiber::Tick(2UL);
+                isFiberRun = ASch::Fiber::Run();
+
+                THEN ("the fiber shall not be resumed")
+                {
+                    REQUIRE (isFiberRun == false);
+                    REQUIRE (std::string(fiberLog) == "1");
+                    REQUIRE_CALLS (0, HalMock::mockHalSystem, WakeUp);
+                }
+                AND_WHEN ("the delay elapses and the fibers are run")
+                {
+                    ASch::Fiber::Tick(1UL);
+                    isFiberRun = ASch::Fiber::Run();
+
+                    THEN ("the system shall be woken up and the fiber shall be resumed until it yields")
+                    {
+                        REQUIRE_CALLS (1, HalMock::mockHalSystem, WakeUp);
+                        REQUIRE (isFiberRun == true);
+                        REQUIRE (std::string(fiberLog) == "12");
+                    }
+                    AND_WHEN ("the fibers are run twice more")
+                    {
+                        (void)ASch::Fiber::Run();
+                        isFiberRun = ASch::Fiber::Run();
+
+                        THEN ("the fiber shall end and its slot shall be freed")
+                        {
+                            REQUIRE (std::string(fiberLog) == "123");
+                            REQUIRE (isFiberRun == false);
+                            REQUIRE (ASch::Fiber::Create(FiberA) == fiber);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN ("two fibers that yield are created")
+    {
+        (void)ASch::Fiber::Create(FiberA);
+        (void)ASch::Fiber::Create(FiberB);
+
+        WHEN ("the main loop runs the fibers twice")
+        {
+            (void)ASch::Fiber::Run();
+            (void)ASch::Fiber::Run();
+
+            THEN ("the fibers shall be interleaved")
+            {
+                REQUIRE (std::string(fiberLog) == "ABab");
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer makes a fiber wait for events", "[fiber]")
+{
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitFiberLog();
+    ASch::Fiber::Deinit();
+
+    GIVEN ("a fiber waits for events 0x2 and 0x4")
+    {
+        ASch::fiberId_t fiber = ASch::Fiber::Create(WaitingFiber);
+        (void)ASch::Fiber::Run();
+
+        WHEN ("an event that is not waited is signalled")
+        {
+            ASch::Fiber::Signal(fiber, 0x1UL);
+
+            THEN ("the fiber shall not be resumed")
+            {
+                REQUIRE (ASch::Fiber::Run() == false);
+                REQUIRE (std::string(fiberLog) == "W");
+                REQUIRE_CALLS (1, HalMock::mockHalSystem, WakeUp);
+            }
+            AND_WHEN ("a waited event is signalled")
+            {
+                ASch::Fiber::Signal(fiber, 0x4UL);
+                (void)ASch::Fiber::Run();
+
+                THEN ("the fiber shall be resumed and it shall receive only the waited event")
+                {
+                    REQUIRE (std::string(fiberLog) == "Ww");
+                    REQUIRE (receivedEvents == 0x4UL);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer uses fibers wrong", "[fiber]")
+{
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitFiberLog();
+    ASch::Fiber::Deinit();
+
+    GIVEN ("the fiber module is initialised")
+    {
+        WHEN ("developer calls Delay outside a fiber")
+        {
+            ASch::Fiber::Delay(1UL);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::accessNotPermitted);
+            }
+        }
+
+        WHEN ("developer creates more fibers than there are slots")
+        {
+            for (std::size_t i = 0U; i < ASch::Config::fibersMax; ++i)
+            {
+                (void)ASch::Fiber::Create(FiberA);
+            }
+            ASch::fiberId_t fiber = ASch::Fiber::Create(FiberB);
+
+            THEN ("a system error shall occur and no fiber shall be created")
+            {
+                REQUIRE (fiber == ASch::invalidFiberId);
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+            }
+        }
+
+        WHEN ("developer signals a fiber that does not exist")
+        {
+            ASch::Fiber::Signal(0U, 0x1UL);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+    }
+}
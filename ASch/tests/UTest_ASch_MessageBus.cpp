@@ -0,0 +1,215 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_ASch_MessageBus.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for ASch_MessageBus.hpp
+//! 
+//! These are unit tests for ASch_MessageBus.hpp utilising Catch2 and FakeIt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Catch_Utils.hpp>
+
+#include <ASch_MessageBus.hpp>
+
+#include <ASch_Scheduler_Mock.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+typedef struct
+{
+    uint32_t value;
+} sample_t;
+
+typedef struct
+{
+    uint8_t code;
+} status_t;
+
+static uint32_t samples[2] = {0UL};
+static uint8_t sampleSubscriberCalls[2] = {0U};
+static uint8_t statusSubscriberCalls = 0U;
+static uint8_t callOrder[2] = {0U};
+static uint8_t callCount = 0U;
+
+static void SampleSubscriber0(sample_t const& sample)
+{
+    samples[0] = sample.value;
+    ++sampleSubscriberCalls[0];
+    callOrder[callCount++] = 0U;
+    return;
+}
+
+static void SampleSubscriber1(sample_t const& sample)
+{
+    samples[1] = sample.value;
+    ++sampleSubscriberCalls[1];
+    callOrder[callCount++] = 1U;
+    return;
+}
+
+static void StatusSubscriber(status_t const& status)
+{
+    (void)status;
+    ++statusSubscriberCalls;
+    return;
+}
+
+// ---------- Deferred event capture ----------
+static ASch::eventHandler_t PostedHandler = 0;
+static uint64_t postedPayload = 0U;
+static std::size_t postedSize = 0U;
+
+static void InitSubscribers(void)
+{
+    for (std::size_t i = 0U; i < 2U; ++i)
+    {
+        samples[i] = 0UL;
+        sampleSubscriberCalls[i] = 0U;
+        callOrder[i] = 0U;
+    }
+    statusSubscriberCalls = 0U;
+    callCount = 0U;
+
+    PostedHandler = 0;
+    postedPayload = 0U;
+    postedSize = 0U;
+}
+
+static void CapturePostedEvents(void)
+{
+    When(Method(ASchMock::mockASchScheduler, PushInlineEvent)).AlwaysDo([](ASch::eventHandler_t Handler, const void* pData, std::size_t size)
+    {
+        // Copies the payload like the event queue does.
+        PostedHandler = Handler;
+        postedSize = size;
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            reinterpret_cast<uint8_t*>(&postedPayload)[i] = static_cast<const uint8_t*>(pData)[i];
+        }
+    });
+}
+
+} // anonymous namespace
+
+namespace ASch
+{
+
+template<> struct Subscription<sample_t> : Subscribers<sample_t, &SampleSubscriber0, &SampleSubscriber1> {};
+template<> struct Subscription<status_t> : Subscribers<status_t, &StatusSubscriber> {};
+
+} // namespace ASch
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer publishes typed messages", "[message_bus]")
+{
+    ASchMock::InitScheduler();
+    InitSubscribers();
+
+    GIVEN ("two subscribers of sample_t and one subscriber of status_t are declared")
+    {
+        WHEN ("a sample_t message is published")
+        {
+            sample_t sample = {.value = 0x12345678UL};
+            ASch::MessageBus::Publish(sample);
+
+            THEN ("the sample_t subscribers shall be called immediately in the declaration order")
+            {
+                REQUIRE (sampleSubscriberCalls[0] == 1U);
+                REQUIRE (sampleSubscriberCalls[1] == 1U);
+                REQUIRE (samples[0] == 0x12345678UL);
+                REQUIRE (samples[1] == 0x12345678UL);
+                REQUIRE (callOrder[0] == 0U);
+                REQUIRE (callOrder[1] == 1U);
+            }
+            AND_THEN ("the status_t subscriber shall not be called and nothing shall be pushed to the scheduler")
+            {
+                REQUIRE (statusSubscriberCalls == 0U);
+                REQUIRE_CALLS (0, ASchMock::mockASchScheduler, PushInlineEvent);
+            }
+        }
+
+        WHEN ("a message of a type without subscribers is published")
+        {
+            uint16_t unsubscribed = 0xABCDU;
+            ASch::MessageBus::Publish(unsubscribed);
+
+            THEN ("no subscriber shall be called")
+            {
+                REQUIRE (sampleSubscriberCalls[0] == 0U);
+                REQUIRE (sampleSubscriberCalls[1] == 0U);
+                REQUIRE (statusSubscriberCalls == 0U);
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer posts typed messages", "[message_bus]")
+{
+    ASchMock::InitScheduler();
+    InitSubscribers();
+    CapturePostedEvents();
+
+    GIVEN ("two subscribers of sample_t are declared")
+    {
+        WHEN ("a sample_t message is posted")
+        {
+            sample_t sample = {.value = 0xCAFEUL};
+            ASch::MessageBus::Post(sample);
+            sample.value = 0UL;
+
+            THEN ("a copy of the message shall be pushed into the event queue")
+            {
+                REQUIRE_CALLS (1, ASchMock::mockASchScheduler, PushInlineEvent);
+                REQUIRE (postedSize == sizeof(sample_t));
+            }
+            AND_THEN ("the subscribers shall not be called before the event is run")
+            {
+                REQUIRE (sampleSubscriberCalls[0] == 0U);
+                REQUIRE (sampleSubscriberCalls[1] == 0U);
+            }
+            AND_WHEN ("the scheduler runs the event")
+            {
+                PostedHandler(static_cast<const void*>(&postedPayload));
+
+                THEN ("the subscribers shall receive the message as it was posted")
+                {
+                    REQUIRE (sampleSubscriberCalls[0] == 1U);
+                    REQUIRE (sampleSubscriberCalls[1] == 1U);
+                    REQUIRE (samples[0] == 0xCAFEUL);
+                    REQUIRE (samples[1] == 0xCAFEUL);
+                    REQUIRE (statusSubscriberCalls == 0U);
+                }
+            }
+        }
+    }
+}
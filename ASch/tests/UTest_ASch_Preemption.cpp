@@ -0,0 +1,349 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_ASch_Preemption.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for ASch_Preemption.cpp
+//! 
+//! These are unit tests for ASch_Preemption.cpp utilising Catch2 and FakeIt. The NVIC is simulated with the Hal_Isr mock:
+//! a pending level interrupt is run right away if its level is higher than the running level and the levels are not masked.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Catch_Utils.hpp>
+
+#include <ASch_Preemption.hpp>
+
+#include <ASch_System_Mock.hpp>
+#include <ASch_Scheduler_Mock.hpp>
+#include <Hal_Isr_Mock.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+// ---------- Simulated NVIC ----------
+static Hal::interruptHandler_t LevelIsrs[2] = {0};
+static bool isLevelPending[2] = {false};
+static bool areLevelsMasked = false;
+
+static std::size_t GetLevelIndex(Hal::Interrupt type)
+{
+    return (type == ASch::Config::preemptionLevels[0].interrupt) ? 0U : 1U;
+}
+
+static void RunPendingLevels(void)
+{
+    for (std::size_t i = 2U; i > 0U; --i)
+    {
+        if ((isLevelPending[i - 1U] == true) && ((i) > ASch::Preemption::GetCurrentLevel()))
+        {
+            isLevelPending[i - 1U] = false;
+            LevelIsrs[i - 1U]();
+            i = 3U;    // Re-evaluate from the highest level.
+        }
+    }
+    return;
+}
+
+static void InitNvic(void)
+{
+    for (std::size_t i = 0U; i < 2U; ++i)
+    {
+        LevelIsrs[i] = 0;
+        isLevelPending[i] = false;
+    }
+    areLevelsMasked = false;
+
+    When(Method(HalMock::mockHalIsr, SetHandler)).AlwaysDo([](Hal::Interrupt type, Hal::interruptHandler_t Handler)
+    {
+        LevelIsrs[GetLevelIndex(type)] = Handler;
+    });
+    When(Method(HalMock::mockHalIsr, SetPending)).AlwaysDo([](Hal::Interrupt type)
+    {
+        isLevelPending[GetLevelIndex(type)] = true;
+        if (areLevelsMasked == false)
+        {
+            RunPendingLevels();
+        }
+    });
+}
+
+// ---------- Test events ----------
+static char callLog[8] = {0};
+static std::size_t callLogLength = 0U;
+static uint8_t levelsInHandlers[2] = {0U};
+static const void* pLowEventData = 0;
+static bool postFromLowEvent = false;
+static bool postFromHighEvent = false;
+
+static void Log(char entry)
+{
+    if (callLogLength < (sizeof(callLog) - 1U))
+    {
+        callLog[callLogLength] = entry;
+        ++callLogLength;
+    }
+    return;
+}
+
+static void HighEvent(const void* pPayload);
+
+static void LowEvent(const void* pPayload)
+{
+    Log('L');
+    pLowEventData = pPayload;
+    levelsInHandlers[0] = ASch::Preemption::GetCurrentLevel();
+    if (postFromLowEvent == true)
+    {
+        ASch::Preemption::PostEvent(2U, {.Handler = HighEvent, .pPayload = 0});
+    }
+    Log('l');
+    return;
+}
+
+static void HighEvent(const void* pPayload)
+{
+    (void)pPayload;
+    Log('H');
+    levelsInHandlers[1] = ASch::Preemption::GetCurrentLevel();
+    if (postFromHighEvent == true)
+    {
+        ASch::Preemption::PostEvent(1U, {.Handler = LowEvent, .pPayload = 0});
+    }
+    Log('h');
+    return;
+}
+
+static uint8_t levelTaskCalls = 0U;
+
+static void LevelTask(void)
+{
+    ++levelTaskCalls;
+    return;
+}
+
+static void InitCallCounters(void)
+{
+    for (std::size_t i = 0U; i < sizeof(callLog); ++i)
+    {
+        callLog[i] = 0;
+    }
+    callLogLength = 0U;
+
+    for (std::size_t i = 0U; i < 2U; ++i)
+    {
+        levelsInHandlers[i] = 0U;
+    }
+    pLowEventData = 0;
+    postFromLowEvent = false;
+    postFromHighEvent = false;
+    levelTaskCalls = 0U;
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer initialises preemption levels", "[preemption]")
+{
+    HalMock::InitIsr();
+    ASchMock::InitSystem();
+    ASchMock::InitScheduler();
+    InitNvic();
+    ASch::Preemption::Deinit();
+
+    GIVEN ("two preemption levels are configured")
+    {
+        WHEN ("the preemption levels are initialised")
+        {
+            ASch::Preemption::Init();
+
+            THEN ("a handler shall be set and the interrupt enabled at the configured priority for each level")
+            {
+                REQUIRE_CALLS (2, HalMock::mockHalIsr, SetHandler);
+                REQUIRE_PARAM_CALLS (1, HalMock::mockHalIsr, SetPriority, Hal::Interrupt::can2_tx, 14UL);
+                REQUIRE_PARAM_CALLS (1, HalMock::mockHalIsr, SetPriority, Hal::Interrupt::can2_rx0, 13UL);
+                REQUIRE_PARAM_CALLS (1, HalMock::mockHalIsr, Enable, Hal::Interrupt::can2_tx);
+                REQUIRE_PARAM_CALLS (1, HalMock::mockHalIsr, Enable, Hal::Interrupt::can2_rx0);
+                REQUIRE (LevelIsrs[0] != LevelIsrs[1]);
+            }
+            AND_THEN ("the main loop level shall be running")
+            {
+                REQUIRE (ASch::Preemption::GetCurrentLevel() == 0U);
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer posts work to preemption levels", "[preemption]")
+{
+    uint8_t testData = 0x12U;
+    HalMock::InitIsr();
+    ASchMock::InitSystem();
+    ASchMock::InitScheduler();
+    InitNvic();
+    InitCallCounters();
+    ASch::Preemption::Deinit();
+
+    GIVEN ("the preemption levels are initialised and the level interrupts are masked")
+    {
+        ASch::Preemption::Init();
+        areLevelsMasked = true;
+
+        WHEN ("two events are posted to level one")
+        {
+            ASch::Preemption::PostEvent(1U, {.Handler = LowEvent, .pPayload = static_cast<void*>(&testData)});
+            ASch::Preemption::PostEvent(1U, {.Handler = LowEvent, .pPayload = static_cast<void*>(&testData)});
+
+            THEN ("the level one interrupt shall be set pending and the events shall not be run yet")
+            {
+                REQUIRE_PARAM_CALLS (2, HalMock::mockHalIsr, SetPending, Hal::Interrupt::can2_tx);
+                REQUIRE (callLogLength == 0U);
+            }
+            AND_WHEN ("the interrupts are unmasked")
+            {
+                areLevelsMasked = false;
+                RunPendingLevels();
+
+                THEN ("both events shall be run to completion at level one with the payload")
+                {
+                    REQUIRE (std::string(callLog) == "LlLl");
+                    REQUIRE (levelsInHandlers[0] == 1U);
+                    REQUIRE (pLowEventData == static_cast<void*>(&testData));
+                    REQUIRE (ASch::Preemption::GetCurrentLevel() == 0U);
+                }
+            }
+        }
+
+        WHEN ("a task is posted to level two and the interrupts are unmasked")
+        {
+            ASch::Preemption::PostTask(2U, LevelTask);
+            areLevelsMasked = false;
+            RunPendingLevels();
+
+            THEN ("the task shall be run once")
+            {
+                REQUIRE_PARAM_CALLS (1, HalMock::mockHalIsr, SetPending, Hal::Interrupt::can2_rx0);
+                REQUIRE (levelTaskCalls == 1U);
+            }
+        }
+    }
+
+    GIVEN ("the preemption levels are initialised")
+    {
+        ASch::Preemption::Init();
+
+        WHEN ("a level one event posts an event to level two")
+        {
+            postFromLowEvent = true;
+            ASch::Preemption::PostEvent(1U, {.Handler = LowEvent, .pPayload = 0});
+
+            THEN ("the level two event shall preempt the level one event")
+            {
+                REQUIRE (std::string(callLog) == "LHhl");
+                REQUIRE (levelsInHandlers[0] == 1U);
+                REQUIRE (levelsInHandlers[1] == 2U);
+                REQUIRE (ASch::Preemption::GetCurrentLevel() == 0U);
+            }
+        }
+
+        WHEN ("a level two event posts an event to level one")
+        {
+            postFromHighEvent = true;
+            ASch::Preemption::PostEvent(2U, {.Handler = HighEvent, .pPayload = 0});
+
+            THEN ("the level one event shall be run after the level two event has completed")
+            {
+                REQUIRE (std::string(callLog) == "HhLl");
+            }
+        }
+
+        WHEN ("an event is posted to level zero")
+        {
+            ASch::Preemption::PostEvent(0U, {.Handler = LowEvent, .pPayload = 0});
+
+            THEN ("the event shall be pushed into the scheduler event queue")
+            {
+                REQUIRE_CALLS (1, ASchMock::mockASchScheduler, PushEvent);
+                REQUIRE_CALLS (0, HalMock::mockHalIsr, SetPending);
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer posts work to preemption levels wrong", "[preemption]")
+{
+    HalMock::InitIsr();
+    ASchMock::InitSystem();
+    ASchMock::InitScheduler();
+    InitNvic();
+    InitCallCounters();
+    ASch::Preemption::Deinit();
+
+    GIVEN ("the preemption levels are initialised and the level interrupts are masked")
+    {
+        ASch::Preemption::Init();
+        areLevelsMasked = true;
+
+        WHEN ("an event is posted to a level that is not configured")
+        {
+            ASch::Preemption::PostEvent(3U, {.Handler = LowEvent, .pPayload = 0});
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+                REQUIRE_CALLS (0, HalMock::mockHalIsr, SetPending);
+            }
+        }
+
+        WHEN ("a task is posted to level zero")
+        {
+            ASch::Preemption::PostTask(0U, LevelTask);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+
+        WHEN ("more events than fit into the level queue are posted")
+        {
+            for (std::size_t i = 0U; i <= ASch::Config::preemptionEventsMax; ++i)
+            {
+                ASch::Preemption::PostEvent(1U, {.Handler = LowEvent, .pPayload = 0});
+            }
+
+            THEN ("a system error shall occur for the last event")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+                REQUIRE_CALLS (ASch::Config::preemptionEventsMax, HalMock::mockHalIsr, SetPending);
+            }
+        }
+    }
+}
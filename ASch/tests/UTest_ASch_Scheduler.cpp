@@ -29,6 +29,9 @@
 // 1. Include Files
 //-----------------------------------------------------------------------------------------------------------------------------
 #include <Catch_Utils.hpp>
+#include <string>
+
+#define SCHEDULER_UNIT_TEST     // For enabling test functions in ASch_TestConfiguration.hpp
 
 #include <ASch_Scheduler.hpp>
 #include <ASch_Scheduler_Private.hpp>
@@ -37,6 +40,10 @@
 #include <Hal_SysTick_Mock.hpp>
 #include <Hal_Isr_Mock.hpp>
 #include <Hal_System_Mock.hpp>
+#include <ASch_Preemption_Mock.hpp>
+#include <ASch_Fiber_Mock.hpp>
+#include <ASch_ActiveObject_Mock.hpp>
+#include <ASch_Arena_Mock.hpp>
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // 2. Test Structs and Variables
@@ -108,8 +115,82 @@ static void TestEventHandler2(const void* pPayload)
     return;
 }
 
+static uint8_t oneShotListenerCalls = 0U;
+
+static void OneShotListener(const void* pPayload)
+{
+    (void)pPayload;
+    ++oneShotListenerCalls;
+    ASch::Scheduler::UnregisterMessageListener({.type = ASch::Message::test_0, .Handler = OneShotListener});
+    ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = TestEventHandler1});
+    return;
+}
+
+static uint8_t tickingEventHandlerCalls = 0U;
+
+// Simulates a SysTick interrupt that occurs while the event is handled.
+static void TickingEventHandler(const void* pPayload)
+{
+    (void)pPayload;
+    ++tickingEventHandlerCalls;
+    ASch::Scheduler::TickHandler();
+    return;
+}
+
+static uint32_t inlineEventDatas[4] = {0UL};
+static uint8_t inlineEventHandlerCalls = 0U;
+
+// Stores the inline payload since it is valid only while the handler runs.
+static void InlineEventHandler(const void* pPayload)
+{
+    if (inlineEventHandlerCalls < 4U)
+    {
+        inlineEventDatas[inlineEventHandlerCalls] = *static_cast<const uint32_t*>(pPayload);
+    }
+    ++inlineEventHandlerCalls;
+    return;
+}
+
+static const void* pRouteDatas[2] = {0};
+static uint8_t routeHandlerCalls[2] = {0U};
+static uint8_t listenerCallsBeforeRoute = 0U;
+
+static ASch::event_t lastDroppedEvent = {.Handler = 0, .pPayload = 0};
+static uint8_t eventOverflowHandlerCalls = 0U;
+
+static void TestEventOverflowHandler(ASch::event_t const& droppedEvent)
+{
+    lastDroppedEvent = droppedEvent;
+    ++eventOverflowHandlerCalls;
+    return;
+}
+
+static uint8_t backgroundJobSlices[2] = {0U};
+
+// Finishes after three slices.
+static bool ShortBackgroundJob(void)
+{
+    ++backgroundJobSlices[0];
+    return (backgroundJobSlices[0] >= 3U);
+}
+
+// Finishes after five slices.
+static bool LongBackgroundJob(void)
+{
+    ++backgroundJobSlices[1];
+    return (backgroundJobSlices[1] >= 5U);
+}
+
+static uint16_t modeTaskCalls[3] = {0U};
+
+static std::string hookTrace;      // Hook calls in order: < > tick, T t task, E e event, I i idle.
+static ASch::taskHandler_t pHookedTask = 0;
+
 static ASch::taskHandler_t Handlers[6] = {TestTask0, TestTask1, TestTask2, TestTask3, TestTask4, TestTask5};
 
+static bool isIsrDisabled = false;
+static uint8_t postsWithIsrDisabled = 0U;
+
 
 static void InitCallCounters(void)
 {
@@ -123,12 +204,147 @@ static void InitCallCounters(void)
         pEventDatas[i] = 0;
         eventHandlerCalls[i] = 0U;
     }
+
+    oneShotListenerCalls = 0U;
+    tickingEventHandlerCalls = 0U;
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        inlineEventDatas[i] = 0UL;
+    }
+    inlineEventHandlerCalls = 0U;
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        pRouteDatas[i] = 0;
+        routeHandlerCalls[i] = 0U;
+    }
+    listenerCallsBeforeRoute = 0U;
+
+    lastDroppedEvent = {.Handler = 0, .pPayload = 0};
+    eventOverflowHandlerCalls = 0U;
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        backgroundJobSlices[i] = 0U;
+    }
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        modeTaskCalls[i] = 0U;
+    }
+
+    hookTrace.clear();
+    pHookedTask = 0;
+
+    isIsrDisabled = false;
+    postsWithIsrDisabled = 0U;
 }
 
 static void RunTicks(uint32_t ticks);
 
 } // anonymous namespace
 
+namespace ASch
+{
+
+// ---------- Static message route handlers of Message::test_3 ----------
+void RouteHandler0(const void* pPayload)
+{
+    pRouteDatas[0] = pPayload;
+    ++routeHandlerCalls[0];
+    listenerCallsBeforeRoute += eventHandlerCalls[0];
+    return;
+}
+
+void RouteHandler1(const void* pPayload)
+{
+    pRouteDatas[1] = pPayload;
+    ++routeHandlerCalls[1];
+    return;
+}
+
+// ---------- Tasks of the schedule modes ----------
+void ModeTask0(void)
+{
+    ++modeTaskCalls[0];
+    return;
+}
+
+void ModeTask1(void)
+{
+    ++modeTaskCalls[1];
+    return;
+}
+
+void ModeTask2(void)
+{
+    ++modeTaskCalls[2];
+    return;
+}
+
+// ---------- Scheduler hooks ----------
+namespace Config
+{
+namespace Hooks
+{
+
+void TaskStart(taskHandler_t Task)
+{
+    hookTrace += 'T';
+    pHookedTask = Task;
+    return;
+}
+
+void TaskEnd(taskHandler_t Task)
+{
+    hookTrace += (Task == pHookedTask) ? 't' : '?';
+    return;
+}
+
+void EventStart(eventHandler_t Handler)
+{
+    (void)Handler;
+    hookTrace += 'E';
+    return;
+}
+
+void EventEnd(eventHandler_t Handler)
+{
+    (void)Handler;
+    hookTrace += 'e';
+    return;
+}
+
+void TickStart(void)
+{
+    hookTrace += '<';
+    return;
+}
+
+void TickEnd(void)
+{
+    hookTrace += '>';
+    return;
+}
+
+void IdleEnter(void)
+{
+    hookTrace += 'I';
+    return;
+}
+
+void IdleExit(void)
+{
+    hookTrace += 'i';
+    return;
+}
+
+} // namespace Hooks
+} // namespace Config
+
+} // namespace ASch
+
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // 3. Test Cases
@@ -136,6 +352,9 @@ static void RunTicks(uint32_t ticks);
 
 SCENARIO ("Developer starts or stops the scheduler", "[scheduler]")
 {
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
     HalMock::InitIsr();
     HalMock::InitSysTick();
     ASch::Scheduler::Deinit();
@@ -190,6 +409,10 @@ SCENARIO ("Developer starts or stops the scheduler", "[scheduler]")
                     }
                 }
             }
+            AND_THEN ("the init-phase arena shall be sealed")
+            {
+                REQUIRE_CALLS (1, ASchMock::mockASchArena, Seal);
+            }
         }
     }
 
@@ -222,6 +445,9 @@ SCENARIO ("Developer starts or stops the scheduler", "[scheduler]")
 
 SCENARIO ("Developer configures scheduler wrong", "[scheduler]")
 {
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
     HalMock::InitIsr();
     HalMock::InitSysTick();
     ASchMock::InitSystem();
@@ -261,6 +487,9 @@ SCENARIO ("Developer configures scheduler wrong", "[scheduler]")
 
 SCENARIO ("Developer configures tasks successfully", "[scheduler]")
 {
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
     HalMock::InitIsr();
     HalMock::InitSystem();
     ASchMock::InitSystem();
@@ -546,6 +775,9 @@ SCENARIO ("Developer configures tasks successfully", "[scheduler]")
 
 SCENARIO ("Developer configures or uses tasks wrong", "[scheduler]")
 {
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
     ASchMock::InitSystem();
     InitCallCounters();
     ASch::Scheduler::Deinit();
@@ -611,148 +843,163 @@ SCENARIO ("Developer configures or uses tasks wrong", "[scheduler]")
     }
 }
 
-SCENARIO ("Developer pushes events successfully", "[scheduler]")
+SCENARIO ("Developer applies admission control to tasks", "[scheduler]")
 {
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
     HalMock::InitIsr();
     HalMock::InitSystem();
+    ASchMock::InitSystem();
     InitCallCounters();
     ASch::Scheduler::Deinit();
-    
-    GIVEN ("the scheduler is running and task list is empty")
+
+    GIVEN ("the scheduler is running and Task0 uses half of the CPU")
     {
         ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::CreateTask({.intervalInMs = 10U, .Task = TestTask0, .level = 0U, .wcetInUs = 5000UL});
 
-        WHEN ("an event is pushed")
+        WHEN ("tasks are rejected and a task that exceeds the utilisation bound of two tasks is created")
         {
-            uint8_t testData0 = 0x12U;
-            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
-            ASch::Scheduler::PushEvent(testEvent);
+            ASch::Scheduler::SetAdmissionPolicy(ASch::AdmissionPolicy::reject);
+            bool isRejected = ASch::Scheduler::CreateTask({.intervalInMs = 10U, .Task = TestTask1, .level = 0U, .wcetInUs = 4000UL});
 
-            THEN ("global interrupts shall be disabled and again enabled")
+            THEN ("the task shall be rejected without a system error")
             {
-                REQUIRE_CALLS (1, HalMock::mockHalIsr, DisableGlobal);
-                REQUIRE_CALLS (1, HalMock::mockHalIsr, EnableGlobal);
-                REQUIRE_CALL_ORDER (CALL(HalMock::mockHalIsr, DisableGlobal) + CALL(HalMock::mockHalIsr, EnableGlobal));
-
-                AND_THEN ("wake up call shall occur")
-                {
-                    REQUIRE_CALLS (1, HalMock::mockHalSystem, WakeUp);
-                }
-                AND_WHEN ("scheduler loop runs")
-                {
-                    ASch::Scheduler::MainLoop();
-
-                    THEN ("TestEventHandler shall be called once with testData0 pointer as payload")
-                    {
-                        REQUIRE (eventHandlerCalls[0] == 1U);
-                        REQUIRE (pEventDatas[0] == static_cast<void*>(&testData0));
-                    }
-                    AND_WHEN ("sheduler loop runs another time")
-                    {
-                        ASch::Scheduler::MainLoop();
-
-                        THEN ("no other event runs shall occur")
-                        {
-                            REQUIRE (eventHandlerCalls[0] == 1U);
-
-                            AND_THEN ("sleep call shall occur")
-                            {
-                                REQUIRE_CALLS (1, HalMock::mockHalSystem, Sleep);
-                            }
-                        }
-                    }
-                }
+                REQUIRE (isRejected == true);
+                REQUIRE (ASch::Scheduler::GetTaskCount() == 1U);
+                REQUIRE (ASch::Scheduler::GetStatus() != ASch::SchedulerStatus::error);
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
             }
         }
-    }
-
-    GIVEN ("the scheduler is running and task list is empty")
-    {
-        ASch::Scheduler::Init(1UL);
 
-        WHEN ("three events are pushed and scheduler loop runs once")
+        WHEN ("tasks are rejected and a periodic task without declared WCET is created")
         {
-            uint8_t testData0 = 0x12U;
-            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
-            ASch::Scheduler::PushEvent(testEvent);
-
-            uint8_t testData1 = 0x34U;
-            testEvent = {.Handler = TestEventHandler1, .pPayload = static_cast<void*>(&testData1)};
-            ASch::Scheduler::PushEvent(testEvent);
-
-            uint8_t testData2 = 0x56U;
-            testEvent = {.Handler = TestEventHandler2, .pPayload = static_cast<void*>(&testData2)};
-            ASch::Scheduler::PushEvent(testEvent);
-
-            ASch::Scheduler::MainLoop();
+            ASch::Scheduler::SetAdmissionPolicy(ASch::AdmissionPolicy::reject);
+            bool isRejected = ASch::Scheduler::CreateTask({.intervalInMs = 10U, .Task = TestTask1, .level = 0U, .wcetInUs = 0UL});
 
-            THEN ("TestEventHandlers shall be called with testData pointers as payload")
+            THEN ("the task shall be rejected without a system error")
             {
-                REQUIRE (eventHandlerCalls[0] == 1U);
-                REQUIRE (pEventDatas[0] == static_cast<void*>(&testData0));
-
-                REQUIRE (eventHandlerCalls[1] == 1U);
-                REQUIRE (pEventDatas[1] == static_cast<void*>(&testData1));
+                REQUIRE (isRejected == true);
+                REQUIRE (ASch::Scheduler::GetTaskCount() == 1U);
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+            }
+        }
 
-                REQUIRE (eventHandlerCalls[2] == 1U);
-                REQUIRE (pEventDatas[2] == static_cast<void*>(&testData2));
+        WHEN ("tasks are rejected and a task within the utilisation bound is created")
+        {
+            ASch::Scheduler::SetAdmissionPolicy(ASch::AdmissionPolicy::reject);
+            bool isRejected = ASch::Scheduler::CreateTask({.intervalInMs = 10U, .Task = TestTask1, .level = 0U, .wcetInUs = 3000UL});
 
-                AND_WHEN ("test event 1 is pushed again with different payload and scheduler loop runs once")
-                {
-                    testEvent = {.Handler = TestEventHandler1, .pPayload = static_cast<void*>(&testData0)};
-                    ASch::Scheduler::PushEvent(testEvent);
+            THEN ("the task shall be created and the task set shall be schedulable")
+            {
+                REQUIRE (isRejected == false);
+                REQUIRE (ASch::Scheduler::GetTaskCount() == 2U);
+                REQUIRE (ASch::Scheduler::GetUtilisation() == 800000UL);
+                REQUIRE (ASch::Scheduler::IsSchedulable() == true);
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+            }
+        }
 
-                    ASch::Scheduler::MainLoop();
+        WHEN ("tasks are flagged and a task that exceeds the utilisation bound is created")
+        {
+            ASch::Scheduler::SetAdmissionPolicy(ASch::AdmissionPolicy::flag);
+            ASch::Scheduler::CreateTask({.intervalInMs = 10U, .Task = TestTask1, .level = 0U, .wcetInUs = 4000UL});
 
-                    THEN ("only TestEventHandler1 shall be called")
-                    {
-                        REQUIRE (eventHandlerCalls[0] == 1U);
-                        REQUIRE (pEventDatas[0] == static_cast<void*>(&testData0));
+            THEN ("the task shall be created and the task set shall be flagged unschedulable")
+            {
+                REQUIRE (ASch::Scheduler::GetTaskCount() == 2U);
+                REQUIRE (ASch::Scheduler::IsSchedulable() == false);
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+            }
+        }
 
-                        REQUIRE (eventHandlerCalls[1] == 2U);
-                        REQUIRE (pEventDatas[1] == static_cast<void*>(&testData0));
+        WHEN ("a task without declared WCET is created and run for 100 us")
+        {
+            ASch::Scheduler::CreateTask({.intervalInMs = 10U, .Task = TestTask1, .level = 0U, .wcetInUs = 0UL});
+            When(Method(HalMock::mockHalSystem, GetCycleCount)).AlwaysReturn(0UL);
+            RunTicks(9UL);
+            When(Method(HalMock::mockHalSystem, GetCycleCount)).Return(0UL, 0UL, 0UL, 100UL * ASch::Config::cpuCyclesPerUs).AlwaysReturn(0UL);
+            ASch::Scheduler::TickHandler();
+            ASch::Scheduler::RunTasks();
 
-                        REQUIRE (eventHandlerCalls[2] == 1U);
-                        REQUIRE (pEventDatas[2] == static_cast<void*>(&testData2));
-                    }
-                }
+            THEN ("the measured time shall be used as the WCET of the task")
+            {
+                REQUIRE (testTaskCalls[1] == 1U);
+                REQUIRE (ASch::Scheduler::GetTaskWcet(0U) == 5000UL);
+                REQUIRE (ASch::Scheduler::GetTaskWcet(1U) == 100UL);
+                REQUIRE (ASch::Scheduler::GetUtilisation() == 510000UL);
             }
         }
     }
 }
 
-SCENARIO ("Developer pushes events unsuccessfully", "[scheduler]")
+SCENARIO ("Scheduler sheds low criticality tasks during overload", "[scheduler]")
 {
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
     ASchMock::InitSystem();
+    InitCallCounters();
     ASch::Scheduler::Deinit();
+    When(Method(HalMock::mockHalSystem, GetCycleCount)).AlwaysReturn(0UL);
 
-    GIVEN ("the scheduler is running and task list is empty")
+    GIVEN ("the elastic mode is enabled with a high, a stretchable and a sheddable task")
     {
         ASch::Scheduler::Init(1UL);
-
-        WHEN ("maximum number of events is pushed")
+        ASch::Scheduler::SetElasticMode(true);
+        ASch::Scheduler::CreateTask({.intervalInMs = 1U, .Task = TestTask0, .level = 0U, .wcetInUs = 0UL,
+                                     .criticality = ASch::TaskCriticality::high});
+        ASch::Scheduler::CreateTask({.intervalInMs = 2U, .Task = TestTask1, .level = 0U, .wcetInUs = 0UL,
+                                     .criticality = ASch::TaskCriticality::stretchable});
+        ASch::Scheduler::CreateTask({.intervalInMs = 2U, .Task = TestTask2, .level = 0U, .wcetInUs = 0UL,
+                                     .criticality = ASch::TaskCriticality::sheddable});
+
+        WHEN ("the main loop keeps up with the tasks for a load window")
         {
-            uint8_t testData0 = 0x12U;
-            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
+            RunTicks(ASch::Config::loadWindowInMs);
 
-            for (std::size_t i = 0; i < ASch::Config::schedulerEventsMax; ++i)
+            THEN ("the scheduler shall not be in overload")
             {
-                ASch::Scheduler::PushEvent(testEvent);
+                REQUIRE (ASch::Scheduler::IsOverloaded() == false);
+                REQUIRE (ASch::Scheduler::GetDeadlineMissCount() == 0UL);
+                REQUIRE (ASch::Scheduler::GetLoad() == 0UL);
             }
+        }
 
-            THEN ("no error shall be triggered")
+        WHEN ("the main loop does not run during a load window")
+        {
+            for (uint16_t i = 0U; i < ASch::Config::loadWindowInMs; ++i)
             {
-                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
-                REQUIRE (ASch::Scheduler::GetStatus() != ASch::SchedulerStatus::error);
+                ASch::Scheduler::TickHandler();
+            }
+            ASch::Scheduler::RunTasks();
 
-                AND_WHEN ("another event is pushed")
+            THEN ("the deadline misses shall put the scheduler in overload")
+            {
+                REQUIRE (ASch::Scheduler::GetDeadlineMissCount() > 0UL);
+                REQUIRE (ASch::Scheduler::IsOverloaded() == true);
+            }
+            AND_WHEN ("four more ticks elapse")
+            {
+                InitCallCounters();
+                RunTicks(4UL);
+
+                THEN ("the high criticality task shall keep its interval, the stretchable task shall run at double interval and the sheddable task shall be suspended")
                 {
-                    ASch::Scheduler::PushEvent(testEvent);
+                    REQUIRE (testTaskCalls[0] == 4U);
+                    REQUIRE (testTaskCalls[1] == 1U);
+                    REQUIRE (testTaskCalls[2] == 0U);
+                }
+                AND_WHEN ("the rest of a load window elapses without misses")
+                {
+                    RunTicks(ASch::Config::loadWindowInMs - 4U);
 
-                    THEN ("a system error shall occur")
+                    THEN ("the tasks shall be restored")
                     {
-                        REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
-                        REQUIRE (ASch::Scheduler::GetStatus() == ASch::SchedulerStatus::error);
+                        REQUIRE (ASch::Scheduler::IsOverloaded() == false);
                     }
                 }
             }
@@ -760,23 +1007,1122 @@ SCENARIO ("Developer pushes events unsuccessfully", "[scheduler]")
     }
 }
 
-SCENARIO ("Developer manages message system successfully", "[scheduler]")
+SCENARIO ("Developer chains tasks into a pipeline", "[scheduler]")
 {
-    uint8_t testData = 0x12U;
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
     ASchMock::InitSystem();
     InitCallCounters();
     ASch::Scheduler::Deinit();
-    
-    GIVEN ("the scheduler is running and task list is empty")
+
+    GIVEN ("Task0 (interval 2) releases stage Task1 and Task1 joins with Task3 (interval 4) to release stage Task2")
     {
         ASch::Scheduler::Init(1UL);
-
-        WHEN ("developer registers two message listeners for message_test_0 and one listener for message_test_1")
+        ASch::Scheduler::CreateTask({.intervalInMs = 0U, .Task = TestTask2});
+        ASch::Scheduler::CreateTask({.intervalInMs = 2U, .Task = TestTask0});
+        ASch::Scheduler::CreateTask({.intervalInMs = 0U, .Task = TestTask1});
+        ASch::Scheduler::CreateTask({.intervalInMs = 4U, .Task = TestTask3});
+        ASch::Scheduler::LinkTasks(TestTask0, TestTask1);
+        ASch::Scheduler::LinkTasks(TestTask1, TestTask2);
+        ASch::Scheduler::LinkTasks(TestTask3, TestTask2);
+
+        WHEN ("two ticks elapse")
         {
-            ASch::messageListener_t listener = {.type = ASch::Message::test_0, .Handler = TestEventHandler0};
-            ASch::Scheduler::RegisterMessageListener(listener);
+            RunTicks(2UL);
 
-            listener = {.type = ASch::Message::test_1, .Handler = TestEventHandler1};
+            THEN ("Task1 shall run in the same pass as Task0 and Task2 shall wait for Task3")
+            {
+                REQUIRE (testTaskCalls[0] == 1U);
+                REQUIRE (testTaskCalls[1] == 1U);
+                REQUIRE (testTaskCalls[2] == 0U);
+                REQUIRE (testTaskCalls[3] == 0U);
+            }
+            AND_WHEN ("two more ticks elapse")
+            {
+                ASch::Scheduler::TickHandler();
+                ASch::Scheduler::TickHandler();
+                ASch::Scheduler::RunTasks();
+
+                THEN ("the whole pipeline shall run in one pass even though Task2 precedes its predecessors")
+                {
+                    REQUIRE (testTaskCalls[0] == 2U);
+                    REQUIRE (testTaskCalls[1] == 2U);
+                    REQUIRE (testTaskCalls[3] == 1U);
+                    REQUIRE (testTaskCalls[2] == 1U);
+                }
+            }
+        }
+
+        WHEN ("Task3 is deleted and four ticks elapse")
+        {
+            ASch::Scheduler::DeleteTask(TestTask3);
+            RunTicks(4UL);
+
+            THEN ("its link shall be removed and Task2 shall be released by Task1 alone")
+            {
+                REQUIRE (testTaskCalls[1] == 2U);
+                REQUIRE (testTaskCalls[2] == 2U);
+            }
+        }
+
+        WHEN ("developer links the tasks into a loop")
+        {
+            ASch::Scheduler::LinkTasks(TestTask2, TestTask0);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+
+        WHEN ("developer links a task that does not exist")
+        {
+            ASch::Scheduler::LinkTasks(TestTask0, TestTask4);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+
+        WHEN ("developer creates more links than fit")
+        {
+            ASch::Scheduler::LinkTasks(TestTask0, TestTask2);
+            ASch::Scheduler::LinkTasks(TestTask3, TestTask1);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer switches schedule modes", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+    When(Method(HalMock::mockHalSystem, GetCycleCount)).AlwaysReturn(0UL);
+
+    GIVEN ("the scheduler is initialised with a task created at runtime")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::CreateTask({.intervalInMs = 1U, .Task = TestTask0});
+
+        WHEN ("the standby mode is switched to")
+        {
+            ASch::Scheduler::SwitchMode(ASch::ScheduleMode::standby, false);
+
+            THEN ("the task set shall not change before the next tick")
+            {
+                REQUIRE (ASch::Scheduler::GetScheduleMode() == ASch::ScheduleMode::invalid);
+                REQUIRE (ASch::Scheduler::GetTaskCount() == 1U);
+                REQUIRE (ASch::Scheduler::GetTaskInterval(0U) == 1U);
+            }
+            AND_WHEN ("four ticks elapse")
+            {
+                RunTicks(4UL);
+
+                THEN ("the task set of the mode shall replace the task set at the first tick")
+                {
+                    REQUIRE (ASch::Scheduler::GetScheduleMode() == ASch::ScheduleMode::standby);
+                    REQUIRE (ASch::Scheduler::GetTaskCount() == 1U);
+                    REQUIRE (ASch::Scheduler::GetTaskInterval(0U) == 4U);
+                    REQUIRE (testTaskCalls[0] == 0U);
+                    REQUIRE (modeTaskCalls[0] == 1U);
+                }
+            }
+        }
+
+        WHEN ("the standby mode is switched to and SysTick triggers")
+        {
+            ASch::Scheduler::SwitchMode(ASch::ScheduleMode::standby, false);
+            ASch::Scheduler::TickHandler();
+
+            THEN ("the task set shall not be changed in the tick handler")
+            {
+                REQUIRE (ASch::Scheduler::GetScheduleMode() == ASch::ScheduleMode::invalid);
+                REQUIRE (ASch::Scheduler::GetTaskCount() == 1U);
+                REQUIRE (ASch::Scheduler::GetTaskInterval(0U) == 1U);
+            }
+            AND_WHEN ("the tasks are run")
+            {
+                ASch::Scheduler::RunTasks();
+
+                THEN ("the mode shall be applied without running the task of the previous set")
+                {
+                    REQUIRE (ASch::Scheduler::GetScheduleMode() == ASch::ScheduleMode::standby);
+                    REQUIRE (ASch::Scheduler::GetTaskInterval(0U) == 4U);
+                    REQUIRE (testTaskCalls[0] == 0U);
+                    REQUIRE (modeTaskCalls[0] == 0U);
+                }
+            }
+        }
+
+        WHEN ("a mode that does not exist is switched to")
+        {
+            ASch::Scheduler::SwitchMode(ASch::ScheduleMode::invalid, false);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+    }
+
+    GIVEN ("the scheduler has been in the standby mode for three ticks")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::SwitchMode(ASch::ScheduleMode::standby, false);
+        RunTicks(3UL);
+
+        WHEN ("the active mode is switched to with the phase preserved and one tick elapses")
+        {
+            ASch::Scheduler::SwitchMode(ASch::ScheduleMode::active, true);
+            RunTicks(1UL);
+
+            THEN ("the task in both modes shall keep its phase and the new tasks shall start a full interval")
+            {
+                REQUIRE (ASch::Scheduler::GetScheduleMode() == ASch::ScheduleMode::active);
+                REQUIRE (ASch::Scheduler::GetTaskCount() == 3U);
+                REQUIRE (modeTaskCalls[0] == 1U);
+                REQUIRE (modeTaskCalls[1] == 0U);
+                REQUIRE (modeTaskCalls[2] == 0U);
+            }
+        }
+
+        WHEN ("the active mode is switched to without the phase preserved and three ticks elapse")
+        {
+            ASch::Scheduler::SwitchMode(ASch::ScheduleMode::active, false);
+            RunTicks(2UL);
+
+            THEN ("all the tasks shall start a full interval from the switch")
+            {
+                REQUIRE (modeTaskCalls[0] == 0U);
+                REQUIRE (modeTaskCalls[1] == 1U);
+            }
+            AND_WHEN ("one more tick elapses")
+            {
+                RunTicks(1UL);
+
+                THEN ("the task in both modes shall run at its new interval")
+                {
+                    REQUIRE (modeTaskCalls[0] == 1U);
+                    REQUIRE (modeTaskCalls[2] == 0U);
+                }
+            }
+        }
+    }
+
+    GIVEN ("the active mode has a stage linked to a task")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::SwitchMode(ASch::ScheduleMode::active, false);
+        RunTicks(1UL);
+        ASch::Scheduler::LinkTasks(ASch::ModeTask1, ASch::ModeTask2);
+
+        WHEN ("one tick elapses")
+        {
+            RunTicks(1UL);
+
+            THEN ("the stage shall be released")
+            {
+                REQUIRE (modeTaskCalls[2] == 1U);
+            }
+        }
+
+        WHEN ("the standby mode and the active mode are switched to and two ticks elapse")
+        {
+            ASch::Scheduler::SwitchMode(ASch::ScheduleMode::standby, false);
+            RunTicks(1UL);
+            ASch::Scheduler::SwitchMode(ASch::ScheduleMode::active, false);
+            RunTicks(2UL);
+
+            THEN ("the link shall have been removed with the tasks of the active mode")
+            {
+                REQUIRE (modeTaskCalls[1] == 1U);
+                REQUIRE (modeTaskCalls[2] == 0U);
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer attaches hooks to the scheduler", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+    When(Method(HalMock::mockHalSystem, GetCycleCount)).AlwaysReturn(0UL);
+
+    GIVEN ("the scheduler is initialised with a task")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::CreateTask({.intervalInMs = 1U, .Task = TestTask0});
+
+        WHEN ("a tick elapses and the task is run")
+        {
+            ASch::Scheduler::TickHandler();
+            ASch::Scheduler::RunTasks();
+
+            THEN ("the tick hooks and the task hooks shall be called around the tick and the task")
+            {
+                REQUIRE (testTaskCalls[0] == 1U);
+                REQUIRE (pHookedTask == TestTask0);
+                REQUIRE (hookTrace == "<>Tt");
+            }
+        }
+
+        WHEN ("an event and a statically routed message are run")
+        {
+            ASch::Scheduler::PushEvent({.Handler = TestEventHandler0, .pPayload = 0});
+            ASch::Scheduler::PushMessage({.type = ASch::Message::test_3, .pPayload = 0});
+            ASch::Scheduler::RunEvents();
+
+            THEN ("the event hooks shall be called around each handler")
+            {
+                REQUIRE (eventHandlerCalls[0] == 1U);
+                REQUIRE (routeHandlerCalls[0] == 1U);
+                REQUIRE (routeHandlerCalls[1] == 1U);
+                REQUIRE (hookTrace == "EeEeEe");
+            }
+        }
+
+        WHEN ("the main loop is idle")
+        {
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the idle hooks shall be called around the sleep")
+            {
+                REQUIRE_CALLS (1, HalMock::mockHalSystem, Sleep);
+                REQUIRE (hookTrace == "Ii");
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer runs tasks at a preemption level", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    ASchMock::InitPreemption();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running and task list is empty")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("a task (Task0) with interval of two is created at level two and a task (Task1) with interval of two at level zero")
+        {
+            ASch::Scheduler::CreateTask({.intervalInMs = 2U, .Task = Handlers[0], .level = 2U});
+            ASch::Scheduler::CreateTask({.intervalInMs = 2U, .Task = Handlers[1]});
+
+            AND_WHEN ("SysTick triggers twice")
+            {
+                RunTicks(2UL);
+
+                THEN ("Task0 shall be posted to level two once and not run in the main loop")
+                {
+                    REQUIRE_PARAM_CALLS (1, ASchMock::mockASchPreemption, PostTask, 2U, Handlers[0]);
+                    REQUIRE_CALLS (1, ASchMock::mockASchPreemption, PostTask);
+                    REQUIRE (testTaskCalls[0] == 0U);
+                }
+                AND_THEN ("Task1 shall be run in the main loop")
+                {
+                    REQUIRE (testTaskCalls[1] == 1U);
+                }
+            }
+        }
+
+        WHEN ("a mode with a preemptive task is switched to and SysTick triggers thrice before the tasks are run")
+        {
+            When(Method(HalMock::mockHalIsr, DisableGlobal)).AlwaysDo([](){ isIsrDisabled = true; });
+            When(Method(HalMock::mockHalIsr, EnableGlobal)).AlwaysDo([](){ isIsrDisabled = false; });
+            When(Method(ASchMock::mockASchPreemption, PostTask)).AlwaysDo([](uint8_t, ASch::taskHandler_t)
+            {
+                postsWithIsrDisabled += (isIsrDisabled == true) ? 1U : 0U;
+            });
+
+            ASch::Scheduler::SwitchMode(ASch::ScheduleMode::preempted, false);
+            ASch::Scheduler::TickHandler();
+            ASch::Scheduler::TickHandler();
+            ASch::Scheduler::TickHandler();
+            ASch::Scheduler::RunTasks();
+
+            Fake(Method(HalMock::mockHalIsr, DisableGlobal));
+            Fake(Method(HalMock::mockHalIsr, EnableGlobal));
+            Fake(Method(ASchMock::mockASchPreemption, PostTask));
+
+            THEN ("the caught-up activations shall be posted to the level after the interrupts are enabled")
+            {
+                REQUIRE (ASch::Scheduler::GetScheduleMode() == ASch::ScheduleMode::preempted);
+                REQUIRE_PARAM_CALLS (3, ASchMock::mockASchPreemption, PostTask, 1U, ASch::ModeTask0);
+                REQUIRE (postsWithIsrDisabled == 0U);
+                REQUIRE (isIsrDisabled == false);
+                REQUIRE (modeTaskCalls[0] == 0U);
+            }
+        }
+
+        WHEN ("a task is created at a level above the configured levels")
+        {
+            ASch::Scheduler::CreateTask({.intervalInMs = 2U, .Task = Handlers[0], .level = static_cast<uint8_t>(ASch::preemptionLevelCount + 1U)});
+
+            THEN ("a system error shall occur and the task shall not be created")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+                REQUIRE (ASch::Scheduler::GetTaskCount() == 0U);
+            }
+        }
+    }
+}
+
+SCENARIO ("Scheduler runs fibers", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running with a tick interval of two")
+    {
+        ASch::Scheduler::Init(2UL);
+
+        WHEN ("SysTick triggers")
+        {
+            ASch::Scheduler::TickHandler();
+
+            THEN ("the fiber delays shall be advanced by the tick interval")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchFiber, Tick, 2UL);
+            }
+        }
+
+        WHEN ("no fiber is ready and the scheduler runs one cycle")
+        {
+            SET_RETURN (ASchMock::mockASchFiber, Run, false);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the fibers shall be checked and the system shall enter sleep")
+            {
+                REQUIRE_CALLS (1, ASchMock::mockASchFiber, Run);
+                REQUIRE_CALLS (1, HalMock::mockHalSystem, Sleep);
+            }
+        }
+
+        WHEN ("a fiber was run and the scheduler runs one cycle")
+        {
+            SET_RETURN (ASchMock::mockASchFiber, Run, true);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the system shall not enter sleep")
+            {
+                REQUIRE_CALLS (0, HalMock::mockHalSystem, Sleep);
+            }
+        }
+    }
+    SET_RETURN (ASchMock::mockASchFiber, Run, false);
+}
+
+SCENARIO ("Scheduler runs active objects", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("no active object has events and the scheduler runs one cycle")
+        {
+            SET_RETURN (ASchMock::mockASchActiveObject, Run, false);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("one active object event shall be requested and the system shall enter sleep")
+            {
+                REQUIRE_CALLS (1, ASchMock::mockASchActiveObject, Run);
+                REQUIRE_CALLS (1, HalMock::mockHalSystem, Sleep);
+            }
+        }
+
+        WHEN ("an active object event was dispatched and the scheduler runs one cycle")
+        {
+            SET_RETURN (ASchMock::mockASchActiveObject, Run, true);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the system shall not enter sleep")
+            {
+                REQUIRE_CALLS (1, ASchMock::mockASchActiveObject, Run);
+                REQUIRE_CALLS (0, HalMock::mockHalSystem, Sleep);
+            }
+        }
+    }
+    SET_RETURN (ASchMock::mockASchActiveObject, Run, false);
+}
+
+SCENARIO ("Developer runs background jobs in idle time", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running and two background jobs are started")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::StartBackgroundJob(ShortBackgroundJob);
+        ASch::Scheduler::StartBackgroundJob(LongBackgroundJob);
+
+        THEN ("the jobs shall be counted")
+        {
+            REQUIRE (ASch::Scheduler::GetNumberOfBackgroundJobs() == 2U);
+        }
+
+        WHEN ("the idle cycle budget is spent after three slices and the scheduler runs one cycle")
+        {
+            When(Method(HalMock::mockHalSystem, GetCycleCount)).Return(0UL, 0UL, 0UL, ASch::Config::backgroundCyclesPerIdle).AlwaysReturn(0UL);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the slices shall be run in round-robin order and the system shall not enter sleep")
+            {
+                REQUIRE (backgroundJobSlices[0] == 2U);
+                REQUIRE (backgroundJobSlices[1] == 1U);
+                REQUIRE_CALLS (0, HalMock::mockHalSystem, Sleep);
+            }
+        }
+
+        WHEN ("an event is pending when the background jobs are run")
+        {
+            When(Method(HalMock::mockHalSystem, GetCycleCount)).AlwaysReturn(0UL);
+            ASch::Scheduler::PushEvent({.Handler = TestEventHandler0, .pPayload = 0});
+            bool isSliceRun = ASch::Scheduler::RunBackgroundJobs();
+
+            THEN ("no slice shall be run before the event")
+            {
+                REQUIRE (isSliceRun == false);
+                REQUIRE (backgroundJobSlices[0] == 0U);
+                REQUIRE (backgroundJobSlices[1] == 0U);
+            }
+        }
+
+        WHEN ("the budget is not spent and the scheduler runs two cycles")
+        {
+            When(Method(HalMock::mockHalSystem, GetCycleCount)).AlwaysReturn(0UL);
+            ASch::Scheduler::MainLoop();
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the jobs shall be run until they have finished and then the system shall enter sleep")
+            {
+                REQUIRE (backgroundJobSlices[0] == 3U);
+                REQUIRE (backgroundJobSlices[1] == 5U);
+                REQUIRE (ASch::Scheduler::GetNumberOfBackgroundJobs() == 0U);
+                REQUIRE_CALLS (1, HalMock::mockHalSystem, Sleep);
+            }
+        }
+
+        WHEN ("the short job is stopped")
+        {
+            ASch::Scheduler::StopBackgroundJob(ShortBackgroundJob);
+
+            THEN ("only the long job shall remain")
+            {
+                REQUIRE (ASch::Scheduler::GetNumberOfBackgroundJobs() == 1U);
+            }
+        }
+
+        WHEN ("developer starts more jobs than fit")
+        {
+            ASch::Scheduler::StartBackgroundJob(ShortBackgroundJob);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+            }
+        }
+
+        WHEN ("developer starts a job without a function")
+        {
+            ASch::Scheduler::StartBackgroundJob(0);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer pushes events successfully", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+    
+    GIVEN ("the scheduler is running and task list is empty")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("an event is pushed")
+        {
+            uint8_t testData0 = 0x12U;
+            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
+            ASch::Scheduler::PushEvent(testEvent);
+
+            THEN ("global interrupts shall be disabled and again enabled")
+            {
+                REQUIRE_CALLS (1, HalMock::mockHalIsr, DisableGlobal);
+                REQUIRE_CALLS (1, HalMock::mockHalIsr, EnableGlobal);
+                REQUIRE_CALL_ORDER (CALL(HalMock::mockHalIsr, DisableGlobal) + CALL(HalMock::mockHalIsr, EnableGlobal));
+
+                AND_THEN ("wake up call shall occur")
+                {
+                    REQUIRE_CALLS (1, HalMock::mockHalSystem, WakeUp);
+                }
+                AND_WHEN ("scheduler loop runs")
+                {
+                    ASch::Scheduler::MainLoop();
+
+                    THEN ("TestEventHandler shall be called once with testData0 pointer as payload")
+                    {
+                        REQUIRE (eventHandlerCalls[0] == 1U);
+                        REQUIRE (pEventDatas[0] == static_cast<void*>(&testData0));
+                    }
+                    AND_WHEN ("sheduler loop runs another time")
+                    {
+                        ASch::Scheduler::MainLoop();
+
+                        THEN ("no other event runs shall occur")
+                        {
+                            REQUIRE (eventHandlerCalls[0] == 1U);
+
+                            AND_THEN ("sleep call shall occur")
+                            {
+                                REQUIRE_CALLS (1, HalMock::mockHalSystem, Sleep);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN ("the scheduler is running and task list is empty")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("three events are pushed and scheduler loop runs once")
+        {
+            uint8_t testData0 = 0x12U;
+            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
+            ASch::Scheduler::PushEvent(testEvent);
+
+            uint8_t testData1 = 0x34U;
+            testEvent = {.Handler = TestEventHandler1, .pPayload = static_cast<void*>(&testData1)};
+            ASch::Scheduler::PushEvent(testEvent);
+
+            uint8_t testData2 = 0x56U;
+            testEvent = {.Handler = TestEventHandler2, .pPayload = static_cast<void*>(&testData2)};
+            ASch::Scheduler::PushEvent(testEvent);
+
+            ASch::Scheduler::MainLoop();
+
+            THEN ("TestEventHandlers shall be called with testData pointers as payload")
+            {
+                REQUIRE (eventHandlerCalls[0] == 1U);
+                REQUIRE (pEventDatas[0] == static_cast<void*>(&testData0));
+
+                REQUIRE (eventHandlerCalls[1] == 1U);
+                REQUIRE (pEventDatas[1] == static_cast<void*>(&testData1));
+
+                REQUIRE (eventHandlerCalls[2] == 1U);
+                REQUIRE (pEventDatas[2] == static_cast<void*>(&testData2));
+
+                AND_WHEN ("test event 1 is pushed again with different payload and scheduler loop runs once")
+                {
+                    testEvent = {.Handler = TestEventHandler1, .pPayload = static_cast<void*>(&testData0)};
+                    ASch::Scheduler::PushEvent(testEvent);
+
+                    ASch::Scheduler::MainLoop();
+
+                    THEN ("only TestEventHandler1 shall be called")
+                    {
+                        REQUIRE (eventHandlerCalls[0] == 1U);
+                        REQUIRE (pEventDatas[0] == static_cast<void*>(&testData0));
+
+                        REQUIRE (eventHandlerCalls[1] == 2U);
+                        REQUIRE (pEventDatas[1] == static_cast<void*>(&testData0));
+
+                        REQUIRE (eventHandlerCalls[2] == 1U);
+                        REQUIRE (pEventDatas[2] == static_cast<void*>(&testData2));
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Event bursts do not starve tasks", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running and there are no tasks")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("more events than fit into one event pass are pushed and scheduler loop runs once")
+        {
+            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = 0};
+            for (std::size_t i = 0; i < (ASch::Config::schedulerEventsPerPass + 2U); ++i)
+            {
+                ASch::Scheduler::PushEvent(testEvent);
+            }
+            ASch::Scheduler::MainLoop();
+
+            THEN ("all the events shall be run since there are no due tasks")
+            {
+                REQUIRE (eventHandlerCalls[0] == (ASch::Config::schedulerEventsPerPass + 2U));
+            }
+        }
+    }
+
+    GIVEN ("the scheduler is running and a task (Task0) with interval of one is created")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::CreateTask({.intervalInMs = 1U, .Task = Handlers[0]});
+
+        WHEN ("more events than fit into one event pass are pushed and SysTick triggers during the events")
+        {
+            ASch::event_t testEvent = {.Handler = TickingEventHandler, .pPayload = 0};
+            for (std::size_t i = 0; i < (ASch::Config::schedulerEventsPerPass + 2U); ++i)
+            {
+                ASch::Scheduler::PushEvent(testEvent);
+            }
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the events shall be run only up to the event pass limit")
+            {
+                REQUIRE (tickingEventHandlerCalls == ASch::Config::schedulerEventsPerPass);
+                REQUIRE (testTaskCalls[0] == 0U);
+
+                AND_WHEN ("scheduler loop runs another time")
+                {
+                    ASch::Scheduler::MainLoop();
+
+                    THEN ("Task0 shall be run before the remaining events")
+                    {
+                        REQUIRE (testTaskCalls[0] == 1U);
+                        REQUIRE (tickingEventHandlerCalls == (ASch::Config::schedulerEventsPerPass + 2U));
+                    }
+                }
+            }
+        }
+
+        WHEN ("the events exceed the cycle budget of an event pass while Task0 is due")
+        {
+            When(Method(HalMock::mockHalSystem, GetCycleCount)).Return(0UL, 0UL, ASch::Config::schedulerEventCyclesPerPass).AlwaysReturn(0UL);
+
+            ASch::event_t testEvent = {.Handler = TickingEventHandler, .pPayload = 0};
+            ASch::Scheduler::PushEvent(testEvent);
+            ASch::Scheduler::PushEvent(testEvent);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the event pass shall end after the cycle budget is spent")
+            {
+                REQUIRE (tickingEventHandlerCalls == 1U);
+
+                AND_WHEN ("scheduler loop runs another time")
+                {
+                    ASch::Scheduler::MainLoop();
+
+                    THEN ("Task0 and the remaining event shall be run")
+                    {
+                        REQUIRE (testTaskCalls[0] == 1U);
+                        REQUIRE (tickingEventHandlerCalls == 2U);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer coalesces duplicate events", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    uint8_t testData0 = 0x12U;
+    uint8_t testData1 = 0x34U;
+
+    GIVEN ("the scheduler is running and event coalescing is not enabled")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("the same event is pushed twice and scheduler loop runs once")
+        {
+            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
+            ASch::Scheduler::PushEvent(testEvent);
+            ASch::Scheduler::PushEvent(testEvent);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the event handler shall be called twice")
+            {
+                REQUIRE (eventHandlerCalls[0] == 2U);
+                REQUIRE (ASch::Scheduler::GetCoalescedEventCount() == 0UL);
+            }
+        }
+    }
+
+    GIVEN ("the scheduler is running and event coalescing is enabled")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::SetEventCoalescing(true);
+
+        WHEN ("the same event is pushed thrice, an event with a different payload is pushed, and scheduler loop runs once")
+        {
+            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
+            ASch::Scheduler::PushEvent(testEvent);
+            ASch::Scheduler::PushEvent(testEvent);
+            ASch::Scheduler::PushEvent(testEvent);
+
+            testEvent.pPayload = static_cast<void*>(&testData1);
+            ASch::Scheduler::PushEvent(testEvent);
+
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the event handler shall be called once per distinct event")
+            {
+                REQUIRE (eventHandlerCalls[0] == 2U);
+                REQUIRE (pEventDatas[0] == static_cast<void*>(&testData1));
+
+                AND_THEN ("the merged pushes shall be counted")
+                {
+                    REQUIRE (ASch::Scheduler::GetCoalescedEventCount() == 2UL);
+                }
+                AND_WHEN ("the first event is pushed again after it has been run and scheduler loop runs once")
+                {
+                    testEvent.pPayload = static_cast<void*>(&testData0);
+                    ASch::Scheduler::PushEvent(testEvent);
+                    ASch::Scheduler::MainLoop();
+
+                    THEN ("the event shall be run again")
+                    {
+                        REQUIRE (eventHandlerCalls[0] == 3U);
+                        REQUIRE (ASch::Scheduler::GetCoalescedEventCount() == 2UL);
+                    }
+                }
+            }
+        }
+
+        WHEN ("an event is pushed again after more distinct events than the coalescing depth and scheduler loop runs once")
+        {
+            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
+            ASch::Scheduler::PushEvent(testEvent);
+            ASch::Scheduler::PushEvent({.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData1)});
+            ASch::Scheduler::PushEvent({.Handler = TestEventHandler1, .pPayload = static_cast<void*>(&testData0)});
+            ASch::Scheduler::PushEvent(testEvent);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the event shall not be compared with the older pending events and shall be run twice")
+            {
+                REQUIRE (ASch::Config::eventCoalescingDepth == 2U);
+                REQUIRE (eventHandlerCalls[0] == 3U);
+                REQUIRE (eventHandlerCalls[1] == 1U);
+                REQUIRE (ASch::Scheduler::GetCoalescedEventCount() == 0UL);
+            }
+        }
+
+        WHEN ("the same event is pushed more times than the event queue can hold")
+        {
+            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
+            for (std::size_t i = 0; i < (ASch::Config::schedulerEventsMax + 1U); ++i)
+            {
+                ASch::Scheduler::PushEvent(testEvent);
+            }
+
+            THEN ("no errors shall be triggered")
+            {
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+                REQUIRE (ASch::Scheduler::GetStatus() != ASch::SchedulerStatus::error);
+            }
+        }
+
+        WHEN ("two listeners are registered for message_test_0 and the same message is pushed twice")
+        {
+            ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = TestEventHandler0});
+            ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = TestEventHandler1});
+
+            ASch::Scheduler::PushMessage({.type = ASch::Message::test_0, .pPayload = static_cast<void*>(&testData0)});
+            ASch::Scheduler::PushMessage({.type = ASch::Message::test_0, .pPayload = static_cast<void*>(&testData0)});
+            ASch::Scheduler::MainLoop();
+
+            THEN ("each listener shall be called once")
+            {
+                REQUIRE (eventHandlerCalls[0] == 1U);
+                REQUIRE (eventHandlerCalls[1] == 1U);
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer pushes events with inline payloads", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running and task list is empty")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("two events with inline payloads are pushed from the same local variable")
+        {
+            uint32_t sample = 0x12345678UL;
+            ASch::Scheduler::PushInlineEvent(InlineEventHandler, sample);
+            sample = 0xCAFEUL;
+            ASch::Scheduler::PushInlineEvent(InlineEventHandler, static_cast<const void*>(&sample), sizeof(sample));
+            sample = 0UL;
+
+            AND_WHEN ("scheduler runs one cycle")
+            {
+                ASch::Scheduler::MainLoop();
+
+                THEN ("the handler shall receive the payloads as they were at the time of the push")
+                {
+                    REQUIRE (inlineEventHandlerCalls == 2U);
+                    REQUIRE (inlineEventDatas[0] == 0x12345678UL);
+                    REQUIRE (inlineEventDatas[1] == 0xCAFEUL);
+                    REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+                }
+            }
+        }
+
+        WHEN ("event coalescing is enabled and inline events are pushed")
+        {
+            uint32_t sample1 = 1UL;
+            uint32_t sample2 = 2UL;
+            ASch::Scheduler::SetEventCoalescing(true);
+            ASch::Scheduler::PushInlineEvent(InlineEventHandler, sample1);
+            ASch::Scheduler::PushInlineEvent(InlineEventHandler, sample2);
+            ASch::Scheduler::PushInlineEvent(InlineEventHandler, sample1);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("only the events with equal payloads shall be merged")
+            {
+                REQUIRE (ASch::Scheduler::GetCoalescedEventCount() == 1UL);
+                REQUIRE (inlineEventHandlerCalls == 2U);
+                REQUIRE (inlineEventDatas[0] == 1UL);
+                REQUIRE (inlineEventDatas[1] == 2UL);
+            }
+        }
+
+        WHEN ("an inline payload larger than the entry is pushed")
+        {
+            uint8_t data[ASch::Config::eventInlinePayloadSize + 1U] = {0U};
+            ASch::Scheduler::PushInlineEvent(InlineEventHandler, static_cast<const void*>(data), sizeof(data));
+            ASch::Scheduler::MainLoop();
+
+            THEN ("a system error shall occur and the event shall not be run")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+                REQUIRE (inlineEventHandlerCalls == 0U);
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer pushes events unsuccessfully", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    ASchMock::InitSystem();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running and task list is empty")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("maximum number of events is pushed")
+        {
+            uint8_t testData0 = 0x12U;
+            ASch::event_t testEvent = {.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData0)};
+
+            for (std::size_t i = 0; i < ASch::Config::schedulerEventsMax; ++i)
+            {
+                ASch::Scheduler::PushEvent(testEvent);
+            }
+
+            THEN ("no error shall be triggered")
+            {
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+                REQUIRE (ASch::Scheduler::GetStatus() != ASch::SchedulerStatus::error);
+
+                AND_WHEN ("another event is pushed")
+                {
+                    ASch::Scheduler::PushEvent(testEvent);
+
+                    THEN ("a system error shall occur")
+                    {
+                        REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+                        REQUIRE (ASch::Scheduler::GetStatus() == ASch::SchedulerStatus::error);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer configures an event overflow policy", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    HalMock::InitSystem();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    uint8_t testData[ASch::Config::schedulerEventsMax + 1U] = {0U};
+
+    GIVEN ("the scheduler is running and the overflow policy is drop-newest with an overflow handler")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::SetEventOverflowPolicy(ASch::EventOverflowPolicy::dropNewest);
+        ASch::Scheduler::SetEventOverflowHandler(TestEventOverflowHandler);
+
+        WHEN ("one event more than the event queue can hold is pushed")
+        {
+            for (std::size_t i = 0; i < (ASch::Config::schedulerEventsMax + 1U); ++i)
+            {
+                ASch::Scheduler::PushEvent({.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData[i])});
+            }
+
+            THEN ("no errors shall be triggered")
+            {
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+                REQUIRE (ASch::Scheduler::GetStatus() != ASch::SchedulerStatus::error);
+
+                AND_THEN ("the last pushed event shall be dropped and notified")
+                {
+                    REQUIRE (ASch::Scheduler::GetDroppedEventCount() == 1UL);
+                    REQUIRE (eventOverflowHandlerCalls == 1U);
+                    REQUIRE (lastDroppedEvent.pPayload == static_cast<void*>(&testData[ASch::Config::schedulerEventsMax]));
+                }
+                AND_WHEN ("scheduler loop runs once")
+                {
+                    ASch::Scheduler::MainLoop();
+
+                    THEN ("the queued events shall be run")
+                    {
+                        REQUIRE (eventHandlerCalls[0] == ASch::Config::schedulerEventsMax);
+                        REQUIRE (pEventDatas[0] == static_cast<void*>(&testData[ASch::Config::schedulerEventsMax - 1U]));
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN ("the scheduler is running and the overflow policy is drop-oldest without an overflow handler")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::SetEventOverflowPolicy(ASch::EventOverflowPolicy::dropOldest);
+
+        WHEN ("one event more than the event queue can hold is pushed and scheduler loop runs once")
+        {
+            for (std::size_t i = 0; i < (ASch::Config::schedulerEventsMax + 1U); ++i)
+            {
+                ASch::Scheduler::PushEvent({.Handler = TestEventHandler0, .pPayload = static_cast<void*>(&testData[i])});
+            }
+            ASch::Scheduler::MainLoop();
+
+            THEN ("no errors shall be triggered and the oldest event shall be dropped")
+            {
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+                REQUIRE (ASch::Scheduler::GetDroppedEventCount() == 1UL);
+                REQUIRE (eventOverflowHandlerCalls == 0U);
+
+                AND_THEN ("the remaining events including the newest one shall be run")
+                {
+                    REQUIRE (eventHandlerCalls[0] == ASch::Config::schedulerEventsMax);
+                    REQUIRE (pEventDatas[0] == static_cast<void*>(&testData[ASch::Config::schedulerEventsMax]));
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer manages message system successfully", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    uint8_t testData = 0x12U;
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+    
+    GIVEN ("the scheduler is running and task list is empty")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("developer registers two message listeners for message_test_0 and one listener for message_test_1")
+        {
+            ASch::messageListener_t listener = {.type = ASch::Message::test_0, .Handler = TestEventHandler0};
+            ASch::Scheduler::RegisterMessageListener(listener);
+
+            listener = {.type = ASch::Message::test_1, .Handler = TestEventHandler1};
             ASch::Scheduler::RegisterMessageListener(listener);
 
             listener = {.type = ASch::Message::test_0, .Handler = TestEventHandler2};
@@ -823,6 +2169,46 @@ SCENARIO ("Developer manages message system successfully", "[scheduler]")
         }
     }
 
+    GIVEN ("the scheduler is running and there are message listeners up to the limit for message_test_0")
+    {
+        HalMock::InitIsr();
+        ASch::Scheduler::Init(1UL);
+
+        ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = TestEventHandler0});
+        ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = TestEventHandler1});
+        ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = TestEventHandler2});
+
+        WHEN ("as many message_test_0 messages as there are event queue slots are posted")
+        {
+            for (std::size_t i = 0; i < ASch::Config::schedulerEventsMax; ++i)
+            {
+                ASch::Scheduler::PushMessage({.type = ASch::Message::test_0, .pPayload = static_cast<void*>(&testData)});
+            }
+
+            THEN ("each message shall take only one event queue slot and no errors shall be triggered")
+            {
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+                REQUIRE (ASch::Scheduler::GetStatus() != ASch::SchedulerStatus::error);
+
+                AND_THEN ("interrupts shall be disabled only once per message")
+                {
+                    REQUIRE_CALLS (ASch::Config::schedulerEventsMax, HalMock::mockHalIsr, DisableGlobal);
+                }
+                AND_WHEN ("scheduler runs one cycle")
+                {
+                    ASch::Scheduler::MainLoop();
+
+                    THEN ("every listener shall receive every message")
+                    {
+                        REQUIRE (eventHandlerCalls[0] == ASch::Config::schedulerEventsMax);
+                        REQUIRE (eventHandlerCalls[1] == ASch::Config::schedulerEventsMax);
+                        REQUIRE (eventHandlerCalls[2] == ASch::Config::schedulerEventsMax);
+                    }
+                }
+            }
+        }
+    }
+
     GIVEN ("the scheduler is running, task list is empty, and there are two message listeners for message_test_0 and one listener for message_test_1")
     {
         ASch::Scheduler::Init(1UL);
@@ -858,10 +2244,372 @@ SCENARIO ("Developer manages message system successfully", "[scheduler]")
             }
         }
     }
+
+    GIVEN ("the scheduler is running and a one-shot listener that registers another listener is followed by a listener for message_test_0")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = OneShotListener});
+        ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = TestEventHandler0});
+
+        WHEN ("a message_test_0 is posted and scheduler runs one cycle")
+        {
+            ASch::Scheduler::PushMessage({.type = ASch::Message::test_0, .pPayload = static_cast<void*>(&testData)});
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the listener after the unregistered one shall be called and the new listener shall not be called")
+            {
+                REQUIRE (oneShotListenerCalls == 1U);
+                REQUIRE (eventHandlerCalls[0] == 1U);
+                REQUIRE (eventHandlerCalls[1] == 0U);
+                REQUIRE (ASch::Scheduler::GetNumberOfMessageListeners(ASch::Message::test_0) == 2U);
+            }
+            AND_WHEN ("another message_test_0 is posted and scheduler runs one cycle")
+            {
+                ASch::Scheduler::PushMessage({.type = ASch::Message::test_0, .pPayload = static_cast<void*>(&testData)});
+                ASch::Scheduler::MainLoop();
+
+                THEN ("only the remaining listeners shall be called")
+                {
+                    REQUIRE (oneShotListenerCalls == 1U);
+                    REQUIRE (eventHandlerCalls[0] == 2U);
+                    REQUIRE (eventHandlerCalls[1] == 1U);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer subscribes to message topics", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    uint8_t testData0 = 0x12U;
+    uint8_t testData2 = 0x34U;
+    HalMock::InitIsr();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("developer registers listeners for the child topic test_a, the parent topic test, and for message_test_2")
+        {
+            ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::invalid, .Handler = TestEventHandler0, .topics = ASch::Topic::test_a});
+            ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::invalid, .Handler = TestEventHandler1, .topics = ASch::Topic::test});
+            ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_2, .Handler = TestEventHandler2});
+
+            THEN ("topic listeners shall be counted as listeners of the messages of their topics")
+            {
+                REQUIRE (ASch::Scheduler::GetNumberOfMessageListeners(ASch::Message::test_0) == 2U);
+                REQUIRE (ASch::Scheduler::GetNumberOfMessageListeners(ASch::Message::test_1) == 2U);
+                REQUIRE (ASch::Scheduler::GetNumberOfMessageListeners(ASch::Message::test_2) == 2U);
+            }
+            AND_THEN ("topic listeners shall not be counted as listeners of an invalid message")
+            {
+                REQUIRE (ASch::Scheduler::GetNumberOfMessageListeners(ASch::Message::invalid) == 0U);
+            }
+            AND_WHEN ("an invalid message is pushed and scheduler runs one cycle")
+            {
+                ASch::Scheduler::PushMessage({.type = ASch::Message::invalid, .pPayload = 0});
+                ASch::Scheduler::MainLoop();
+
+                THEN ("a system error shall occur and no listener shall receive the message")
+                {
+                    REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+                    REQUIRE (eventHandlerCalls[0] == 0U);
+                    REQUIRE (eventHandlerCalls[1] == 0U);
+                }
+            }
+            AND_WHEN ("message_test_0 and message_test_2 are posted and scheduler runs one cycle")
+            {
+                ASch::Scheduler::PushMessage({.type = ASch::Message::test_0, .pPayload = static_cast<void*>(&testData0)});
+                ASch::Scheduler::PushMessage({.type = ASch::Message::test_2, .pPayload = static_cast<void*>(&testData2)});
+                ASch::Scheduler::MainLoop();
+
+                THEN ("the test_a topic listener shall receive only message_test_0")
+                {
+                    REQUIRE (eventHandlerCalls[0] == 1U);
+                    REQUIRE (pEventDatas[0] == static_cast<void*>(&testData0));
+                }
+                AND_THEN ("the test topic listener shall receive both messages")
+                {
+                    REQUIRE (eventHandlerCalls[1] == 2U);
+                    REQUIRE (pEventDatas[1] == static_cast<void*>(&testData2));
+                }
+                AND_THEN ("the message_test_2 listener shall receive only message_test_2")
+                {
+                    REQUIRE (eventHandlerCalls[2] == 1U);
+                    REQUIRE (pEventDatas[2] == static_cast<void*>(&testData2));
+                }
+            }
+            AND_WHEN ("developer unregisters the test topic listener and message_test_2 is posted")
+            {
+                ASch::Scheduler::UnregisterMessageListener({.type = ASch::Message::invalid, .Handler = TestEventHandler1, .topics = ASch::Topic::test});
+                ASch::Scheduler::PushMessage({.type = ASch::Message::test_2, .pPayload = static_cast<void*>(&testData2)});
+                ASch::Scheduler::MainLoop();
+
+                THEN ("only the message_test_2 listener shall receive the message")
+                {
+                    REQUIRE (ASch::Scheduler::GetNumberOfMessageListeners(ASch::Message::test_2) == 1U);
+                    REQUIRE (eventHandlerCalls[1] == 0U);
+                    REQUIRE (eventHandlerCalls[2] == 1U);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer routes messages statically", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    uint8_t testData = 0x12U;
+    HalMock::InitIsr();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running and two handlers are routed to message_test_3 in the configuration")
+    {
+        ASch::Scheduler::Init(1UL);
+
+        WHEN ("no listeners are registered at runtime")
+        {
+            THEN ("the routed handlers shall be counted as listeners of message_test_3 only")
+            {
+                REQUIRE (ASch::Scheduler::GetNumberOfMessageListeners(ASch::Message::test_3) == 2U);
+                REQUIRE (ASch::Scheduler::GetNumberOfMessageListeners(ASch::Message::test_0) == 0U);
+            }
+            AND_WHEN ("a message_test_3 is posted and scheduler runs one cycle")
+            {
+                ASch::Scheduler::PushMessage({.type = ASch::Message::test_3, .pPayload = static_cast<void*>(&testData)});
+                ASch::Scheduler::MainLoop();
+
+                THEN ("both routed handlers shall receive the message")
+                {
+                    REQUIRE (routeHandlerCalls[0] == 1U);
+                    REQUIRE (routeHandlerCalls[1] == 1U);
+                    REQUIRE (pRouteDatas[0] == static_cast<void*>(&testData));
+                    REQUIRE (pRouteDatas[1] == static_cast<void*>(&testData));
+                }
+            }
+        }
+
+        WHEN ("a listener of message_test_3 is also registered at runtime")
+        {
+            ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_3, .Handler = TestEventHandler0});
+
+            THEN ("the routed handlers and the runtime listener shall be counted")
+            {
+                REQUIRE (ASch::Scheduler::GetNumberOfMessageListeners(ASch::Message::test_3) == 3U);
+            }
+            AND_WHEN ("a message_test_3 is posted and scheduler runs one cycle")
+            {
+                ASch::Scheduler::PushMessage({.type = ASch::Message::test_3, .pPayload = static_cast<void*>(&testData)});
+                ASch::Scheduler::MainLoop();
+
+                THEN ("all the listeners shall receive the message once and the routed handlers shall be called first")
+                {
+                    REQUIRE (routeHandlerCalls[0] == 1U);
+                    REQUIRE (routeHandlerCalls[1] == 1U);
+                    REQUIRE (eventHandlerCalls[0] == 1U);
+                    REQUIRE (listenerCallsBeforeRoute == 0U);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer shares pooled message payloads", "[scheduler]")
+{
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
+    HalMock::InitIsr();
+    ASchMock::InitSystem();
+    InitCallCounters();
+    ASch::Scheduler::Deinit();
+
+    GIVEN ("the scheduler is running and two listeners are registered for message_test_0")
+    {
+        ASch::Scheduler::Init(1UL);
+        ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = TestEventHandler0});
+        ASch::Scheduler::RegisterMessageListener({.type = ASch::Message::test_0, .Handler = TestEventHandler1});
+
+        WHEN ("developer allocates every block of the payload pool")
+        {
+            ASch::payloadHandle_t payload0 = ASch::Scheduler::AllocatePayload();
+            ASch::payloadHandle_t payload1 = ASch::Scheduler::AllocatePayload();
+
+            THEN ("the blocks shall be distinct and the pool shall be empty")
+            {
+                REQUIRE (payload0 != ASch::noPayloadHandle);
+                REQUIRE (payload1 != ASch::noPayloadHandle);
+                REQUIRE (ASch::Scheduler::GetPayload(payload0) != ASch::Scheduler::GetPayload(payload1));
+                REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 0U);
+            }
+            AND_WHEN ("developer tries to allocate one more block")
+            {
+                ASch::payloadHandle_t payload2 = ASch::Scheduler::AllocatePayload();
+
+                THEN ("no block shall be given and no system error shall occur")
+                {
+                    REQUIRE (payload2 == ASch::noPayloadHandle);
+                    REQUIRE (ASch::Scheduler::GetPayload(payload2) == 0);
+                    REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+                }
+                AND_THEN ("the failed allocation shall be counted")
+                {
+                    REQUIRE (ASch::Scheduler::GetPayloadAllocationFailureCount() == 1UL);
+                }
+            }
+            AND_WHEN ("developer releases a block")
+            {
+                ASch::Scheduler::ReleasePayload(payload0);
+
+                THEN ("the block shall be returned to the pool")
+                {
+                    REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 1U);
+                }
+                AND_THEN ("the high-water mark shall still show the peak usage")
+                {
+                    REQUIRE (ASch::Scheduler::GetPayloadHighWaterMark() == 2U);
+                    REQUIRE (ASch::Scheduler::GetPayloadAllocationFailureCount() == 0UL);
+                }
+            }
+        }
+
+        WHEN ("a pooled message_test_0 is pushed")
+        {
+            ASch::payloadHandle_t payload = ASch::Scheduler::AllocatePayload();
+            *static_cast<uint8_t*>(ASch::Scheduler::GetPayload(payload)) = 0x12U;
+            ASch::Scheduler::PushPooledMessage(ASch::Message::test_0, payload);
+
+            THEN ("the block shall be held until the message is run")
+            {
+                REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 1U);
+                REQUIRE (*static_cast<const uint8_t*>(ASch::Scheduler::GetPayload(payload)) == 0x12U);
+            }
+            AND_WHEN ("scheduler runs one cycle")
+            {
+                ASch::Scheduler::MainLoop();
+
+                THEN ("both listeners shall receive the same block without copying")
+                {
+                    REQUIRE (eventHandlerCalls[0] == 1U);
+                    REQUIRE (eventHandlerCalls[1] == 1U);
+                    REQUIRE (pEventDatas[0] == ASch::Scheduler::GetPayload(payload));
+                    REQUIRE (pEventDatas[1] == ASch::Scheduler::GetPayload(payload));
+                }
+                AND_THEN ("the block shall be released after the last listener has returned")
+                {
+                    REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 2U);
+                }
+            }
+        }
+
+        WHEN ("developer retains a block and pushes it in a pooled message_test_0")
+        {
+            ASch::payloadHandle_t payload = ASch::Scheduler::AllocatePayload();
+            ASch::Scheduler::RetainPayload(payload);
+            ASch::Scheduler::PushPooledMessage(ASch::Message::test_0, payload);
+            ASch::Scheduler::MainLoop();
+
+            THEN ("the block shall stay allocated until developer releases it")
+            {
+                REQUIRE (eventHandlerCalls[0] == 1U);
+                REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 1U);
+                ASch::Scheduler::ReleasePayload(payload);
+                REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 2U);
+            }
+        }
+
+        WHEN ("a pooled message without listeners is pushed")
+        {
+            ASch::payloadHandle_t payload = ASch::Scheduler::AllocatePayload();
+            ASch::Scheduler::PushPooledMessage(ASch::Message::test_2, payload);
+
+            THEN ("the block shall be released right away")
+            {
+                REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 2U);
+                REQUIRE (eventHandlerCalls[0] == 0U);
+            }
+        }
+
+        WHEN ("a pooled message is dropped due to a full event queue")
+        {
+            ASch::Scheduler::SetEventOverflowPolicy(ASch::EventOverflowPolicy::dropNewest);
+            for (uint8_t i = 0U; i < ASch::Config::schedulerEventsMax; ++i)
+            {
+                ASch::Scheduler::PushEvent({.Handler = TestEventHandler2, .pPayload = 0});
+            }
+            ASch::payloadHandle_t payload = ASch::Scheduler::AllocatePayload();
+            ASch::Scheduler::PushPooledMessage(ASch::Message::test_0, payload);
+
+            THEN ("the block shall be released")
+            {
+                REQUIRE (ASch::Scheduler::GetDroppedEventCount() == 1UL);
+                REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 2U);
+            }
+        }
+
+        WHEN ("a pooled message is pushed into a full event queue with the system error policy")
+        {
+            for (uint8_t i = 0U; i < ASch::Config::schedulerEventsMax; ++i)
+            {
+                ASch::Scheduler::PushEvent({.Handler = TestEventHandler2, .pPayload = 0});
+            }
+            ASch::payloadHandle_t payload = ASch::Scheduler::AllocatePayload();
+            ASch::Scheduler::PushPooledMessage(ASch::Message::test_0, payload);
+
+            THEN ("a system error shall occur and the block shall be released")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+                REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 2U);
+            }
+        }
+
+        WHEN ("developer retains a block until it has 255 references")
+        {
+            ASch::payloadHandle_t payload = ASch::Scheduler::AllocatePayload();
+            for (uint16_t i = 1U; i < 255U; ++i)
+            {
+                ASch::Scheduler::RetainPayload(payload);
+            }
+
+            THEN ("no system error shall occur")
+            {
+                REQUIRE_CALLS (0, ASchMock::mockASchSystem, Error);
+            }
+            AND_WHEN ("developer retains the block once more and releases all but one of the references")
+            {
+                ASch::Scheduler::RetainPayload(payload);
+                for (uint16_t i = 1U; i < 255U; ++i)
+                {
+                    ASch::Scheduler::ReleasePayload(payload);
+                }
+
+                THEN ("a system error shall occur and the block shall still be allocated by the last reference")
+                {
+                    REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::insufficientResources);
+                    REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 1U);
+                    ASch::Scheduler::ReleasePayload(payload);
+                    REQUIRE (ASch::Scheduler::GetNumberOfFreePayloads() == 2U);
+                }
+            }
+        }
+    }
 }
 
 SCENARIO ("Developer manages message system unsuccessfully", "[scheduler]")
 {
+    ASchMock::InitFiber();
+    ASchMock::InitActiveObject();
+    ASchMock::InitArena();
     uint8_t testData = 0x12U;
     ASchMock::InitSystem();
     InitCallCounters();
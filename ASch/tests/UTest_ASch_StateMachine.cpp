@@ -0,0 +1,334 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_ASch_StateMachine.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for ASch_StateMachine.cpp
+//! 
+//! These are unit tests for ASch_StateMachine.cpp utilising Catch2 and FakeIt.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Catch_Utils.hpp>
+
+#include <ASch_StateMachine.hpp>
+
+#include <ASch_System_Mock.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+static char actionLog[32] = {0};
+static std::size_t actionLogLength = 0U;
+static bool isStartAllowed = false;
+
+static void Log(char entry)
+{
+    if (actionLogLength < (sizeof(actionLog) - 1U))
+    {
+        actionLog[actionLogLength] = entry;
+        ++actionLogLength;
+    }
+    return;
+}
+
+static void InitActionLog(void)
+{
+    for (std::size_t i = 0U; i < sizeof(actionLog); ++i)
+    {
+        actionLog[i] = 0;
+    }
+    actionLogLength = 0U;
+}
+
+// ---------- Test actions ----------
+static void EnterTop(const void*)
+{
+    Log('T');
+    return;
+}
+
+static void ExitTop(const void*)
+{
+    Log('t');
+    return;
+}
+
+static void EnterIdle(const void*)
+{
+    Log('I');
+    return;
+}
+
+static void ExitIdle(const void*)
+{
+    Log('i');
+    return;
+}
+
+static void EnterActive(const void*)
+{
+    Log('A');
+    return;
+}
+
+static void ExitActive(const void*)
+{
+    Log('a');
+    return;
+}
+
+static void EnterLow(const void*)
+{
+    Log('L');
+    return;
+}
+
+static void ExitLow(const void*)
+{
+    Log('l');
+    return;
+}
+
+static void EnterHigh(const void*)
+{
+    Log('H');
+    return;
+}
+
+static void ExitHigh(const void*)
+{
+    Log('h');
+    return;
+}
+
+static void Stop(const void*)
+{
+    Log('>');
+    return;
+}
+
+static void Ping(const void* pPayload)
+{
+    Log(*static_cast<const char*>(pPayload));
+    return;
+}
+
+static bool IsStartAllowed(const void*)
+{
+    return isStartAllowed;
+}
+
+// ---------- Test state machine ----------
+enum : ASch::stateId_t
+{
+    top = 0U,
+    idle,
+    active,
+    low,
+    high
+};
+
+enum : ASch::hsmSignal_t
+{
+    start = 0U,
+    stop,
+    up,
+    down,
+    ping,
+    reset
+};
+
+constexpr ASch::hsmState_t states[] =
+{
+    {.parent = ASch::noState, .initial = idle,          .Entry = EnterTop,    .Exit = ExitTop},
+    {.parent = top,           .initial = ASch::noState, .Entry = EnterIdle,   .Exit = ExitIdle},
+    {.parent = top,           .initial = low,           .Entry = EnterActive, .Exit = ExitActive},
+    {.parent = active,        .initial = ASch::noState, .Entry = EnterLow,    .Exit = ExitLow},
+    {.parent = active,        .initial = ASch::noState, .Entry = EnterHigh,   .Exit = ExitHigh}
+};
+
+constexpr ASch::hsmTransition_t transitions[] =
+{
+    {.source = top,    .signal = reset, .target = top,           .Guard = 0,              .Action = 0},
+    {.source = idle,   .signal = start, .target = active,        .Guard = IsStartAllowed, .Action = 0},
+    {.source = active, .signal = stop,  .target = idle,          .Guard = 0,              .Action = Stop},
+    {.source = active, .signal = ping,  .target = ASch::noState, .Guard = 0,              .Action = Ping},
+    {.source = low,    .signal = up,    .target = high,          .Guard = 0,              .Action = 0},
+    {.source = high,   .signal = down,  .target = low,           .Guard = 0,              .Action = 0}
+};
+
+static_assert(ASch::StateMachine::IsSorted(transitions), "Transition table is not sorted.");
+static_assert(ASch::StateMachine::HasValidParents(states), "State table has invalid parents.");
+
+constexpr ASch::hsmTransition_t unsortedTransitions[] =
+{
+    {.source = active, .signal = stop, .target = idle, .Guard = 0, .Action = 0},
+    {.source = idle,   .signal = stop, .target = idle, .Guard = 0, .Action = 0}
+};
+
+static_assert(ASch::StateMachine::IsSorted(unsortedTransitions) == false, "Unsorted table is not detected.");
+
+constexpr ASch::hsmState_t selfInitialStates[] =
+{
+    {.parent = ASch::noState, .initial = 0U,            .Entry = 0, .Exit = 0}
+};
+
+static_assert(ASch::StateMachine::HasValidParents(selfInitialStates) == false, "A state that is its own default substate is not detected.");
+
+constexpr ASch::hsmState_t nestedInitialStates[] =
+{
+    {.parent = ASch::noState, .initial = 2U,            .Entry = 0, .Exit = 0},
+    {.parent = 0U,            .initial = ASch::noState, .Entry = 0, .Exit = 0},
+    {.parent = 1U,            .initial = ASch::noState, .Entry = 0, .Exit = 0}
+};
+
+static_assert(ASch::StateMachine::HasValidParents(nestedInitialStates) == false, "A default substate that is not a direct substate is not detected.");
+
+ASch::StateMachine machine(states, transitions);
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer drives a hierarchical state machine", "[state_machine]")
+{
+    ASchMock::InitSystem();
+    InitActionLog();
+    isStartAllowed = false;
+
+    GIVEN ("the machine is started in the idle state")
+    {
+        machine.Start(idle);
+
+        THEN ("the top and the idle states shall be entered")
+        {
+            REQUIRE (std::string(actionLog) == "TI");
+            REQUIRE (machine.GetState() == idle);
+            REQUIRE (machine.IsIn(top) == true);
+            REQUIRE (machine.IsIn(active) == false);
+        }
+
+        WHEN ("a signal that is not handled is dispatched")
+        {
+            bool isHandled = machine.Dispatch(up, 0);
+
+            THEN ("nothing shall happen")
+            {
+                REQUIRE (isHandled == false);
+                REQUIRE (std::string(actionLog) == "TI");
+            }
+        }
+
+        WHEN ("start is dispatched while its guard fails")
+        {
+            bool isHandled = machine.Dispatch(start, 0);
+
+            THEN ("the transition shall not be taken")
+            {
+                REQUIRE (isHandled == false);
+                REQUIRE (machine.GetState() == idle);
+            }
+        }
+
+        WHEN ("start is dispatched while its guard passes")
+        {
+            isStartAllowed = true;
+            InitActionLog();
+            bool isHandled = machine.Dispatch(start, 0);
+
+            THEN ("idle shall be exited and active shall be entered with its default substate")
+            {
+                REQUIRE (isHandled == true);
+                REQUIRE (std::string(actionLog) == "iAL");
+                REQUIRE (machine.GetState() == low);
+                REQUIRE (machine.IsIn(active) == true);
+            }
+            AND_WHEN ("a transition between sibling substates is dispatched with an ASch event handler")
+            {
+                InitActionLog();
+                ASch::StateMachine::Handler<machine, up>(0);
+
+                THEN ("only the substates shall be exited and entered")
+                {
+                    REQUIRE (std::string(actionLog) == "lH");
+                    REQUIRE (machine.GetState() == high);
+                }
+                AND_WHEN ("a signal handled by the parent state is dispatched")
+                {
+                    InitActionLog();
+                    (void)machine.Dispatch(stop, 0);
+
+                    THEN ("the exit chain, the action and the entry chain shall be run in order")
+                    {
+                        REQUIRE (std::string(actionLog) == "ha>I");
+                        REQUIRE (machine.GetState() == idle);
+                    }
+                }
+                AND_WHEN ("the top state transits to itself")
+                {
+                    InitActionLog();
+                    (void)machine.Dispatch(reset, 0);
+
+                    THEN ("all the states shall be exited and the machine shall be entered again")
+                    {
+                        REQUIRE (std::string(actionLog) == "hatTI");
+                        REQUIRE (machine.GetState() == idle);
+                    }
+                }
+            }
+            AND_WHEN ("an internal transition is dispatched with a payload")
+            {
+                const char payload = 'p';
+                InitActionLog();
+                bool isInternalHandled = machine.Dispatch(ping, &payload);
+
+                THEN ("only the action shall be run with the payload")
+                {
+                    REQUIRE (isInternalHandled == true);
+                    REQUIRE (std::string(actionLog) == "p");
+                    REQUIRE (machine.GetState() == low);
+                }
+            }
+        }
+    }
+
+    GIVEN ("the machine is not started")
+    {
+        WHEN ("developer starts the machine in a state that does not exist")
+        {
+            machine.Start(10U);
+
+            THEN ("a system error shall occur")
+            {
+                REQUIRE_PARAM_CALLS (1, ASchMock::mockASchSystem, Error, ASch::SysError::invalidParameters);
+            }
+        }
+    }
+}
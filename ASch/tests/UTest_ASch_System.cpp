@@ -36,6 +36,8 @@
 #include <Hal_System_Mock.hpp>
 #include <Hal_Clocks_Mock.hpp>
 #include <ASch_Scheduler_Mock.hpp>
+#include <ASch_ActiveObject_Mock.hpp>
+#include <ASch_Preemption_Mock.hpp>
 
 #include <ASch_System.hpp>
 #include <ASch_Configuration.hpp>
@@ -93,6 +95,8 @@ SCENARIO ("A system is initialised", "[system]")
 {
     HalMock::InitSystem();
     ASchMock::InitScheduler();
+    ASchMock::InitActiveObject();
+    ASchMock::InitPreemption();
     InitConfigCallCounts();
     
     GIVEN ("a system is not yet initialised")
@@ -105,11 +109,26 @@ SCENARIO ("A system is initialised", "[system]")
             {
                 REQUIRE_CALLS (1, HalMock::mockHalSystem, InitPowerControl);
 
+                AND_THEN ("the cycle counter shall be initialised")
+                {
+                    REQUIRE_CALLS (1, HalMock::mockHalSystem, InitCycleCounter);
+                }
+
                 AND_THEN ("scheduler shall be initialised with configured tick value after HAL inits")
                 {
                     REQUIRE_PARAM_CALLS (1, ASchMock::mockASchScheduler, Init, ASch::Config::schedulerTickInterval);
                     REQUIRE_CALL_ORDER (CALL(HalMock::mockHalSystem, InitPowerControl) + CALL(ASchMock::mockASchScheduler, Init));
                 }
+
+                AND_THEN ("the active objects shall be initialised")
+                {
+                    REQUIRE_CALLS (1, ASchMock::mockASchActiveObject, Init);
+                }
+
+                AND_THEN ("the preemption levels shall be initialised")
+                {
+                    REQUIRE_CALLS (1, ASchMock::mockASchPreemption, Init);
+                }
             }
         }
     }
@@ -32,6 +32,8 @@
 // 1. Include Dependencies
 //-----------------------------------------------------------------------------------------------------------------------------
 
+#include <Hal_Interrupts.hpp>
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // 2. Typedefs, Structs, Enums and Constants
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -40,6 +42,71 @@ namespace ASch
 {
 
 typedef void (*configFunction_t)(void);
+typedef void (*messageHandler_t)(const void*);  //!< A function pointer type for message handlers.
+typedef void (*taskHandler_t)(void);            //!< A function pointer type for task handlers.
+typedef void (*eventHandler_t)(const void*);    //!< A function pointer type for event handlers.
+
+/// @brief This is a task criticality enum. The criticality decides how a task is degraded during overload in the elastic
+/// mode.
+enum class TaskCriticality
+{
+    high = 0,       //!< The task keeps its interval. This is the default criticality.
+    stretchable,    //!< The interval of the task is multiplied by Config::elasticStretchFactor.
+    sheddable       //!< The task is suspended.
+};
+
+/// @brief This is a task struct that is used to create tasks.
+typedef struct
+{
+    uint16_t intervalInMs;          //!< Task interval in milliseconds.
+    taskHandler_t Task;             //!< A function pointer for the task.
+    uint8_t level;                  //!< Preemption level of the task. Zero runs the task in the main loop.
+    uint32_t wcetInUs;              //!< Optional worst-case execution time in microseconds. Zero uses the measured time.
+    TaskCriticality criticality;    //!< Criticality of the task.
+} task_t;
+
+/// @brief This is a schedule mode, i.e. a precomputed task set that is laid out in flash at compile time.
+typedef struct
+{
+    const task_t* pTasks;   //!< Pointer to the task list.
+    std::size_t count;      //!< Number of tasks in the list.
+} scheduleMode_t;
+
+const scheduleMode_t noTasks = {.pTasks = 0, .count = 0U};   //!< A schedule mode without tasks.
+
+/// @brief This is a static message route, i.e. a list of message handlers that is laid out in flash at compile time.
+typedef struct
+{
+    const messageHandler_t* pHandlers;  //!< Pointer to the handler list.
+    std::size_t count;                  //!< Number of handlers in the list.
+} messageRoute_t;
+
+const messageRoute_t noRoute = {.pHandlers = 0, .count = 0U};   //!< A route of a message without static listeners.
+
+/// @brief This is a preemptive priority level that is run in a software triggered interrupt.
+typedef struct
+{
+    Hal::Interrupt interrupt;   //!< An otherwise unused interrupt that runs the level.
+    uint32_t priority;          //!< NVIC priority of the interrupt.
+} preemptionLevel_t;
+
+/// @brief This function creates a schedule mode of a task list.
+/// @param modeTasks - A reference to the task list.
+/// @return The schedule mode.
+template<std::size_t N>
+constexpr scheduleMode_t Mode(task_t const (&modeTasks)[N])
+{
+    return {modeTasks, N};
+}
+
+/// @brief This function creates a static message route of a handler list.
+/// @param handlers - A reference to the handler list.
+/// @return The route.
+template<std::size_t N>
+constexpr messageRoute_t Route(messageHandler_t const (&handlers)[N])
+{
+    return {handlers, N};
+}
 
 }
 
@@ -57,6 +124,32 @@ namespace ASch
 {
 
 const std::size_t preStartConfigurationFunctionsMax = sizeof(apPreStartConfigFunctions)/sizeof(configFunction_t);
+const std::size_t preemptionLevelCount = sizeof(Config::preemptionLevels)/sizeof(preemptionLevel_t);
+
+static_assert((sizeof(Config::messageTopics)/sizeof(uint32_t)) == static_cast<std::size_t>(Message::invalid),
+              "Config::messageTopics must have an entry for each message type.");
+static_assert((sizeof(Config::messageRoutes)/sizeof(messageRoute_t)) == static_cast<std::size_t>(Message::invalid),
+              "Config::messageRoutes must have an entry for each message type.");
+static_assert(Config::loadWindowInMs > 0U, "Config::loadWindowInMs must be at least one millisecond.");
+static_assert(Config::overloadRestoreThreshold <= Config::overloadThreshold,
+              "Config::overloadRestoreThreshold must not exceed Config::overloadThreshold.");
+static_assert(Config::elasticStretchFactor > 0U, "Config::elasticStretchFactor must be at least one.");
+static_assert(Config::arenaSize > 0U, "Config::arenaSize must be at least one byte.");
+
+const std::size_t scheduleModeCount = sizeof(Config::scheduleModes)/sizeof(scheduleMode_t);
+
+/// @brief This function checks that the task sets of the schedule modes fit into the task list of the scheduler.
+/// @param mode - Index of the first mode to check.
+/// @return True if the modes are valid.
+constexpr bool AreScheduleModesValid(std::size_t mode)
+{
+    return (mode >= scheduleModeCount) ||
+           ((Config::scheduleModes[mode].count <= Config::schedulerTasksMax) && AreScheduleModesValid(mode + 1U));
+}
+
+static_assert(scheduleModeCount == static_cast<std::size_t>(ScheduleMode::invalid),
+              "Config::scheduleModes must have an entry for each schedule mode.");
+static_assert(AreScheduleModesValid(0U) == true, "A schedule mode must not exceed Config::schedulerTasksMax tasks.");
 
 }
 
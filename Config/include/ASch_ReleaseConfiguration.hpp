@@ -49,14 +49,156 @@ enum class Message
     invalid // Do not remove! Leave last.
 };
 
+/// Schedule modes, i.e. precomputed task sets that Scheduler::SwitchMode swaps in. See Config::scheduleModes.
+enum class ScheduleMode
+{
+    normal = 0,
+
+    invalid // Do not remove! Leave last.
+};
+
+/// Owners of the init-phase arena memory. Arena::GetUsage reports the memory taken by each owner.
+enum class ArenaOwner
+{
+    system = 0,
+    application,
+
+    invalid // Do not remove! Leave last.
+};
+
+/// Message topics are bitmasks that group messages into families. A message may belong to several topics, e.g. to a topic
+/// and its parent topic, so that listeners can subscribe to a family of messages with a single registration.
+namespace Topic
+{
+
+const uint32_t none = 0x0UL;
+
+} // namespace Topic
+
 namespace Config
 {
 
+/// Topics of each message. Indexed by Message.
+const uint32_t messageTopics[] =
+{
+    Topic::none     // Message::message
+};
+
+/// Static message routes. Indexed by Message.
+/// The listeners of a fixed set of components can be routed here instead of registering them at runtime. A route is
+/// declared from a handler list, e.g. Route(messageRouteHandlers), where
+/// const messageHandler_t messageRouteHandlers[] = {Component0_MessageHandler, Component1_MessageHandler};
+constexpr messageRoute_t messageRoutes[] =
+{
+    noRoute         // Message::message
+};
+
+/// Task sets of the schedule modes. Indexed by ScheduleMode.
+/// A mode is declared from a task list, e.g. Mode(activeTasks), where
+/// const task_t activeTasks[] = {{.intervalInMs = 10U, .Task = Component0_Task}, {.intervalInMs = 100U, .Task = Component1_Task}};
+constexpr scheduleMode_t scheduleModes[] =
+{
+    noTasks         // ScheduleMode::normal
+};
+
 const std::size_t schedulerTasksMax = 5;
+const std::size_t schedulerTaskLinksMax = 8;    //!< Maximum number of task dependency links.
+
+/// Elastic mode. The load of the main loop is measured over windows of loadWindowInMs. Overload starts when the load or
+/// the deadline misses of a window reach their thresholds and ends when the load of a window without misses drops to
+/// overloadRestoreThreshold. The loads are given in parts per million.
+const uint16_t loadWindowInMs = 100U;
+const uint32_t overloadThreshold = 900000UL;
+const uint32_t overloadRestoreThreshold = 700000UL;
+const uint8_t overloadDeadlineMisses = 1U;
+const uint16_t elasticStretchFactor = 2U;   //!< Multiplier of the intervals of stretchable tasks during overload.
+
 const std::size_t schedulerEventsMax = 10;
+const std::size_t schedulerEventsPerPass = 8;          //!< Events run before due tasks are checked. Zero disables the limit.
+const uint32_t schedulerEventCyclesPerPass = 0UL;    //!< CPU cycles spent on events before due tasks are checked. Zero disables the limit.
+const std::size_t eventCoalescingDepth = 4;     //!< Newest pending events compared when an event is coalesced.
+const std::size_t eventInlinePayloadSize = 0;   //!< Size of the payload copied into an event queue entry in bytes. Zero disables inline payloads and MessageBus::Post.
 const std::size_t messageListenersMax = 10;
+const std::size_t payloadBlockSize = 64;   //!< Size of a message payload pool block in bytes.
+const std::size_t payloadBlocksMax = 4;    //!< Number of message payload pool blocks.
+const std::size_t backgroundJobsMax = 4;         //!< Maximum number of background jobs.
+const uint32_t backgroundCyclesPerIdle = 50000UL; //!< CPU cycles given to background jobs per idle main loop round.
 
 const uint16_t schedulerTickInterval = 1UL;
+const uint32_t cpuCyclesPerUs = 180UL;    //!< CPU cycles per microsecond. Used to convert measured task execution times.
+
+/// Scheduler hooks. The scheduler calls the hooks around each task run in RunTasks, each event and message handler call
+/// in RunEvents, each tick, and each sleep of the idle main loop, e.g. for tracing, watchdog kicking or GPIO timing probes.
+/// The hooks are inline, so an empty hook compiles away.
+namespace Hooks
+{
+
+inline void TaskStart(taskHandler_t Task)
+{
+    (void)Task;
+    return;
+}
+
+inline void TaskEnd(taskHandler_t Task)
+{
+    (void)Task;
+    return;
+}
+
+inline void EventStart(eventHandler_t Handler)
+{
+    (void)Handler;
+    return;
+}
+
+inline void EventEnd(eventHandler_t Handler)
+{
+    (void)Handler;
+    return;
+}
+
+inline void TickStart(void)
+{
+    return;
+}
+
+inline void TickEnd(void)
+{
+    return;
+}
+
+inline void IdleEnter(void)
+{
+    return;
+}
+
+inline void IdleExit(void)
+{
+    return;
+}
+
+} // namespace Hooks
+
+/// Preemptive priority levels. Level n is run in the software triggered interrupt of entry n - 1 and it preempts the main
+/// loop and all the lower levels. The priority of a level must be higher than the priority of the levels below it.
+const preemptionLevel_t preemptionLevels[] =
+{
+    {.interrupt = Hal::Interrupt::spi4, .priority = 14UL},    // Level 1
+    {.interrupt = Hal::Interrupt::spi5, .priority = 13UL},    // Level 2
+    {.interrupt = Hal::Interrupt::spi6, .priority = 12UL}     // Level 3
+};
+const std::size_t preemptionEventsMax = 8;   //!< Size of the event queue of each preemption level.
+
+const std::size_t fibersMax = 2;            //!< Maximum number of fibers.
+const std::size_t fiberStackSize = 1024;    //!< Stack size of each fiber in bytes. The stacks are placed in CCMRAM.
+
+const std::size_t activeObjectsMax = 8;     //!< Maximum number of active objects. Must not exceed 32.
+
+const std::size_t arenaSize = 4096;         //!< Size of the init-phase arena in bytes.
+
+/// Placement of the init-phase arena. Empty places the arena in the default RAM. E.g. __attribute__((section(".ccmram_bss")))
+/// places it in the uninitialised CCMRAM section, which is not accessible by DMA.
+#define ARENA_SECTION
 
 } // namespace Config
 
@@ -46,17 +46,235 @@ enum class Message
 {
     test_0 = 0,
     test_1,
+    test_2,
+    test_3,
     invalid // Do not remove! Leave last.
 };
 
+/// Schedule modes, i.e. precomputed task sets that Scheduler::SwitchMode swaps in. See Config::scheduleModes.
+enum class ScheduleMode
+{
+    standby = 0,
+    active,
+    preempted,
+    invalid // Do not remove! Leave last.
+};
+
+/// Owners of the init-phase arena memory. Arena::GetUsage reports the memory taken by each owner.
+enum class ArenaOwner
+{
+    test_0 = 0,
+    test_1,
+    invalid // Do not remove! Leave last.
+};
+
+/// Message topics are bitmasks that group messages into families. A message may belong to several topics, e.g. to a topic
+/// and its parent topic, so that listeners can subscribe to a family of messages with a single registration.
+namespace Topic
+{
+
+const uint32_t none = 0x0UL;
+const uint32_t test = 0x1UL;        // Parent topic of all test messages.
+const uint32_t test_a = 0x2UL;      // Child topic of test.
+
+} // namespace Topic
+
+namespace Config
+{
+
+/// Topics of each message. Indexed by Message.
+const uint32_t messageTopics[] =
+{
+    Topic::test | Topic::test_a,    // Message::test_0
+    Topic::test | Topic::test_a,    // Message::test_1
+    Topic::test,                    // Message::test_2
+    Topic::none                     // Message::test_3
+};
+
+} // namespace Config
+
+#ifdef SCHEDULER_UNIT_TEST
+    // Test function prototypes
+    void RouteHandler0(const void* pPayload);
+    void RouteHandler1(const void* pPayload);
+#endif
+
+namespace Config
+{
+
+/// Static message routes. Indexed by Message.
+#ifdef SCHEDULER_UNIT_TEST
+    const messageHandler_t test3RouteHandlers[] = {RouteHandler0, RouteHandler1};
+
+    constexpr messageRoute_t messageRoutes[] =
+    {
+        noRoute,                        // Message::test_0
+        noRoute,                        // Message::test_1
+        noRoute,                        // Message::test_2
+        Route(test3RouteHandlers)       // Message::test_3
+    };
+#else
+    constexpr messageRoute_t messageRoutes[] =
+    {
+        noRoute,                        // Message::test_0
+        noRoute,                        // Message::test_1
+        noRoute,                        // Message::test_2
+        noRoute                         // Message::test_3
+    };
+#endif
+
+} // namespace Config
+
+#ifdef SCHEDULER_UNIT_TEST
+    // Test function prototypes
+    void ModeTask0(void);
+    void ModeTask1(void);
+    void ModeTask2(void);
+#endif
+
 namespace Config
 {
 
+/// Task sets of the schedule modes. Indexed by ScheduleMode.
+#ifdef SCHEDULER_UNIT_TEST
+    const task_t standbyTasks[] =
+    {
+        {.intervalInMs = 4U, .Task = ModeTask0}
+    };
+
+    const task_t activeTasks[] =
+    {
+        {.intervalInMs = 2U, .Task = ModeTask1},
+        {.intervalInMs = 3U, .Task = ModeTask0},
+        {.intervalInMs = 0U, .Task = ModeTask2}
+    };
+
+    const task_t preemptedTasks[] =
+    {
+        {.intervalInMs = 1U, .Task = ModeTask0, .level = 1U}
+    };
+
+    constexpr scheduleMode_t scheduleModes[] =
+    {
+        Mode(standbyTasks),             // ScheduleMode::standby
+        Mode(activeTasks),              // ScheduleMode::active
+        Mode(preemptedTasks)            // ScheduleMode::preempted
+    };
+#else
+    constexpr scheduleMode_t scheduleModes[] =
+    {
+        noTasks,                        // ScheduleMode::standby
+        noTasks,                        // ScheduleMode::active
+        noTasks                         // ScheduleMode::preempted
+    };
+#endif
+
 const std::size_t schedulerTasksMax = 5;
+const std::size_t schedulerTaskLinksMax = 4;    //!< Maximum number of task dependency links.
+
+/// Elastic mode. The load of the main loop is measured over windows of loadWindowInMs. Overload starts when the load or
+/// the deadline misses of a window reach their thresholds and ends when the load of a window without misses drops to
+/// overloadRestoreThreshold. The loads are given in parts per million.
+const uint16_t loadWindowInMs = 10U;
+const uint32_t overloadThreshold = 900000UL;
+const uint32_t overloadRestoreThreshold = 700000UL;
+const uint8_t overloadDeadlineMisses = 1U;
+const uint16_t elasticStretchFactor = 2U;   //!< Multiplier of the intervals of stretchable tasks during overload.
+
 const std::size_t schedulerEventsMax = 10;
+const std::size_t schedulerEventsPerPass = 4;          //!< Events run before due tasks are checked. Zero disables the limit.
+const uint32_t schedulerEventCyclesPerPass = 10000UL;    //!< CPU cycles spent on events before due tasks are checked. Zero disables the limit.
+const std::size_t eventCoalescingDepth = 2;     //!< Newest pending events compared when an event is coalesced.
+const std::size_t eventInlinePayloadSize = 8;   //!< Size of the payload copied into an event queue entry in bytes.
 const std::size_t messageListenersMax = 3;
+const std::size_t payloadBlockSize = 16;   //!< Size of a message payload pool block in bytes.
+const std::size_t payloadBlocksMax = 2;    //!< Number of message payload pool blocks.
+const std::size_t backgroundJobsMax = 2;         //!< Maximum number of background jobs.
+const uint32_t backgroundCyclesPerIdle = 10000UL;  //!< CPU cycles given to background jobs per idle main loop round.
 
 const uint16_t schedulerTickInterval = 1UL;
+const uint32_t cpuCyclesPerUs = 100UL;    //!< CPU cycles per microsecond. Used to convert measured task execution times.
+
+/// Scheduler hooks. See ASch_ReleaseConfiguration.hpp.
+namespace Hooks
+{
+
+#ifdef SCHEDULER_UNIT_TEST
+    // Test function prototypes
+    void TaskStart(taskHandler_t Task);
+    void TaskEnd(taskHandler_t Task);
+    void EventStart(eventHandler_t Handler);
+    void EventEnd(eventHandler_t Handler);
+    void TickStart(void);
+    void TickEnd(void);
+    void IdleEnter(void);
+    void IdleExit(void);
+#else
+    inline void TaskStart(taskHandler_t Task)
+    {
+        (void)Task;
+        return;
+    }
+
+    inline void TaskEnd(taskHandler_t Task)
+    {
+        (void)Task;
+        return;
+    }
+
+    inline void EventStart(eventHandler_t Handler)
+    {
+        (void)Handler;
+        return;
+    }
+
+    inline void EventEnd(eventHandler_t Handler)
+    {
+        (void)Handler;
+        return;
+    }
+
+    inline void TickStart(void)
+    {
+        return;
+    }
+
+    inline void TickEnd(void)
+    {
+        return;
+    }
+
+    inline void IdleEnter(void)
+    {
+        return;
+    }
+
+    inline void IdleExit(void)
+    {
+        return;
+    }
+#endif
+
+} // namespace Hooks
+
+/// Preemptive priority levels. Level n is run in the software triggered interrupt of entry n - 1 and it preempts the main
+/// loop and all the lower levels. The priority of a level must be higher than the priority of the levels below it.
+const preemptionLevel_t preemptionLevels[] =
+{
+    {.interrupt = Hal::Interrupt::can2_tx, .priority = 14UL},     // Level 1
+    {.interrupt = Hal::Interrupt::can2_rx0, .priority = 13UL}     // Level 2
+};
+const std::size_t preemptionEventsMax = 3;   //!< Size of the event queue of each preemption level.
+
+const std::size_t fibersMax = 2;            //!< Maximum number of fibers.
+const std::size_t fiberStackSize = 65536;   //!< Stack size of each fiber in bytes. The stacks are placed in CCMRAM.
+
+const std::size_t activeObjectsMax = 3;     //!< Maximum number of active objects. Must not exceed 32.
+
+const std::size_t arenaSize = 64;           //!< Size of the init-phase arena in bytes.
+
+/// Placement of the init-phase arena. Empty places the arena in the default RAM.
+#define ARENA_SECTION
 
 } // namespace Config
 
@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    Hal_Context.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Context
+//! @brief   This is HAL interface for execution context switching.
+
+#ifndef HAL_CONTEXT_HPP_
+#define HAL_CONTEXT_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+
+#if (UNIT_TEST == 1) && !defined(_WIN32)
+    #include <ucontext.h>
+#endif
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Hal
+{
+
+typedef void (*contextEntry_t)(void);   //!< A function pointer type for context entry functions.
+
+/// @brief This is an execution context, i.e. the saved state of a stack.
+typedef struct
+{
+    void* pStackPointer;        //!< Saved stack pointer of the context. A host fiber handle on Windows hosts.
+#if (UNIT_TEST == 1) && !defined(_WIN32)
+    ucontext_t hostContext;     //!< Saved host context.
+#endif
+} context_t;
+
+} // namespace Hal
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Hal
+{
+
+//! @class Context
+//! @brief This is HAL interface for execution context switching.
+//! The contexts are switched cooperatively from thread mode. Callee-saved registers are stored on the stack of the
+//! context that is switched out.
+class Context
+{
+public:
+    /// @brief Simple constructor.
+    explicit Context(void) {};
+
+    /// @brief Prepares a context that starts from the given entry function when it is switched to for the first time.
+    /// The entry function must never return.
+    /// @param context - A reference to the context.
+    /// @param pStack - Pointer to the bottom of the stack of the context.
+    /// @param stackSize - Size of the stack in bytes.
+    /// @param Entry - Pointer to the entry function.
+    static void Init(context_t& context, void* pStack, std::size_t stackSize, contextEntry_t Entry);
+
+    /// @brief Saves the running context and switches to another context.
+    /// @param from - A reference to the context where the running context is saved.
+    /// @param to - A reference to the context to be resumed.
+    static void Switch(context_t& from, context_t& to);
+
+private:
+
+};
+
+} // namespace Hal
+
+#endif // HAL_CONTEXT_HPP_
@@ -125,6 +125,27 @@ private:
 
 };
 
+//! @class IsrLock
+//! @brief This is a lock type that disables global interrupts, e.g. for Utils::Pool instances that are used from ISRs.
+//! The lock does not nest, so it must not be taken while the interrupts are already disabled.
+class IsrLock
+{
+public:
+    /// @brief This function takes the lock.
+    static void Lock(void)
+    {
+        Isr::DisableGlobal();
+        return;
+    }
+
+    /// @brief This function releases the lock.
+    static void Unlock(void)
+    {
+        Isr::EnableGlobal();
+        return;
+    }
+};
+
 } // namespace Hal
 
 #endif // HAL_ISR_HPP_
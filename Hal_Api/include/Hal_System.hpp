@@ -79,6 +79,13 @@ public:
     /// @brief A debugger trap.
     static void HaltDeubgger(void);
 
+    /// @brief Initialises and starts the free-running CPU cycle counter.
+    static void InitCycleCounter(void);
+
+    /// @brief Returns the current value of the free-running CPU cycle counter.
+    /// @return CPU cycle count. The counter wraps around at 2^32.
+    static uint32_t GetCycleCount(void);
+
 private:
 
 };
@@ -54,6 +54,8 @@ void InitClocks(void)
         Fake(Method(mockHalClocks, ConfigurePllManually));
         Fake(Method(mockHalClocks, GetPllSource));
         Fake(Method(mockHalClocks, IsRunning));
+        Fake(Method(mockHalClocks, SetFrequency));
+        Fake(Method(mockHalClocks, GetFrequency));
         Fake(Method(mockHalClocks, GetSysClockFrequency));
         Fake(Method(mockHalClocks, SetSysClockSource));
         Fake(Method(mockHalClocks, GetSysClockSource));
@@ -62,7 +64,7 @@ void InitClocks(void)
     }
     else
     {
-        mockHalClocks.Reset();
+        mockHalClocks.ClearInvocationHistory();
     }
     return;
 }
@@ -106,6 +108,17 @@ bool Clocks::IsRunning(Hal::OscillatorType type)
     return HalMock::clocks.IsRunning(type);
 }
 
+void Clocks::SetFrequency(Hal::OscillatorType type, uint32_t frequency)
+{
+    HalMock::clocks.SetFrequency(type, frequency);
+    return;
+}
+
+uint32_t Clocks::GetFrequency(Hal::OscillatorType type)
+{
+    return HalMock::clocks.GetFrequency(type);
+}
+
 uint32_t Clocks::GetSysClockFrequency(void)
 {
     return HalMock::clocks.GetSysClockFrequency();
@@ -55,12 +55,14 @@ public:
 
     virtual Hal::Error Enable(Hal::OscillatorType type);
     virtual Hal::Error Disable(Hal::OscillatorType type);
-    virtual Hal::Error ConfigurePll(OscillatorType source, uint32_t frequency);
-    virtual Hal::Error ConfigurePllManually(OscillatorType source, pllRegisters_t const& registers);
-    virtual OscillatorType GetPllSource(void);
+    virtual Hal::Error ConfigurePll(Hal::OscillatorType source, uint32_t frequency);
+    virtual Hal::Error ConfigurePllManually(Hal::OscillatorType source, Hal::pllRegisters_t const& registers);
+    virtual Hal::OscillatorType GetPllSource(void);
     virtual bool IsRunning(Hal::OscillatorType type);
+    virtual void SetFrequency(Hal::OscillatorType type, uint32_t frequency);
+    virtual uint32_t GetFrequency(Hal::OscillatorType type);
     virtual uint32_t GetSysClockFrequency(void);
-    virtual Error SetSysClockSource(Hal::OscillatorType type);
+    virtual Hal::Error SetSysClockSource(Hal::OscillatorType type);
     virtual Hal::OscillatorType GetSysClockSource(void);
 
 private:
@@ -0,0 +1,103 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    Hal_Context_Mock.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @brief   Host implementation of HAL Context.
+//! 
+//! Unlike the other HAL mocks this is not a FakeIt mock. Fibers need real context switches in unit tests, so the contexts
+//! are switched with ucontext, or with the fiber API on Windows hosts.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Hal_Context.hpp>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Mock Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Hal
+{
+
+#ifdef _WIN32
+
+namespace
+{
+
+static void CALLBACK FiberStart(LPVOID pParameter)
+{
+    reinterpret_cast<contextEntry_t>(pParameter)();
+    return;
+}
+
+} // anonymous namespace
+
+void Context::Init(context_t& context, void* pStack, std::size_t stackSize, contextEntry_t Entry)
+{
+    // Windows fibers allocate their own stacks. A reused slot still holds the handle of its finished fiber.
+    (void)pStack;
+    if (context.pStackPointer != 0)
+    {
+        DeleteFiber(context.pStackPointer);
+    }
+    context.pStackPointer = CreateFiber(stackSize, FiberStart, reinterpret_cast<LPVOID>(Entry));
+    return;
+}
+
+void Context::Switch(context_t& from, context_t& to)
+{
+    if (IsThreadAFiber() == FALSE)
+    {
+        (void)ConvertThreadToFiber(0);
+    }
+    from.pStackPointer = GetCurrentFiber();
+    SwitchToFiber(to.pStackPointer);
+    return;
+}
+
+#else
+
+void Context::Init(context_t& context, void* pStack, std::size_t stackSize, contextEntry_t Entry)
+{
+    (void)getcontext(&context.hostContext);
+    context.hostContext.uc_stack.ss_sp = pStack;
+    context.hostContext.uc_stack.ss_size = stackSize;
+    context.hostContext.uc_link = 0;
+    makecontext(&context.hostContext, Entry, 0);
+    context.pStackPointer = pStack;
+    return;
+}
+
+void Context::Switch(context_t& from, context_t& to)
+{
+    (void)swapcontext(&from.hostContext, &to.hostContext);
+    return;
+}
+
+#endif
+
+} // namespace Hal
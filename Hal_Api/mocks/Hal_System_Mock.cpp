@@ -54,6 +54,8 @@ void InitSystem(void)
         Fake(Method(mockHalSystem, Reset));
         Fake(Method(mockHalSystem, CriticalSystemError));
         Fake(Method(mockHalSystem, HaltDeubgger));
+        Fake(Method(mockHalSystem, InitCycleCounter));
+        Fake(Method(mockHalSystem, GetCycleCount));
 
         isFirstInit = false;
     }
@@ -109,5 +111,16 @@ void System::HaltDeubgger(void)
     return;
 }
 
+void System::InitCycleCounter(void)
+{
+    HalMock::system.InitCycleCounter();
+    return;
+}
+
+uint32_t System::GetCycleCount(void)
+{
+    return HalMock::system.GetCycleCount();
+}
+
 } // namespace Hal
 
@@ -55,6 +55,8 @@ public:
     virtual void Reset(void);
     virtual void CriticalSystemError(void);
     virtual void HaltDeubgger(void);
+    virtual void InitCycleCounter(void);
+    virtual uint32_t GetCycleCount(void);
 };
 
 /// @brief The mock entity for accessing FakeIt interface.
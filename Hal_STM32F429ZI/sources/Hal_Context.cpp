@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    Hal_Context.cpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Context
+//! @brief   This is HAL for execution context switching.
+//! 
+//! The contexts are switched directly in thread mode. Since the switches are cooperative, only the callee-saved core and
+//! FPU registers need to be stored and no exception (e.g. PendSV) is needed.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Hal_Context.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+const std::size_t fpuRegistersInFrame = 16U;    //!< s16-s31
+const std::size_t coreRegistersInFrame = 8U;    //!< r4-r11
+const std::size_t frameSizeInWords = fpuRegistersInFrame + coreRegistersInFrame + 1U;   //!< Saved registers and return address.
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Local Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Static Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 6. Class Member Definitions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Hal
+{
+
+void Context::Init(context_t& context, void* pStack, std::size_t stackSize, contextEntry_t Entry)
+{
+    // The stack pointer shall be 8-byte aligned when the entry function is called.
+    uintptr_t stackTop = (reinterpret_cast<uintptr_t>(pStack) + stackSize) & ~static_cast<uintptr_t>(0x7U);
+    uint32_t* pFrame = reinterpret_cast<uint32_t*>(stackTop) - frameSizeInWords;
+
+    for (std::size_t i = 0U; i < (frameSizeInWords - 1U); ++i)
+    {
+        pFrame[i] = 0UL;
+    }
+    pFrame[frameSizeInWords - 1U] = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(Entry));
+
+    context.pStackPointer = static_cast<void*>(pFrame);
+    return;
+}
+
+__attribute__((naked)) void Context::Switch(context_t& from, context_t& to)
+{
+    // r0 = &from.pStackPointer, r1 = &to.pStackPointer
+    __asm volatile
+    (
+        "push       {r4-r11, lr}    \n"
+        "vpush      {s16-s31}       \n"
+        "mov        r2, sp          \n"
+        "str        r2, [r0]        \n"
+        "ldr        r2, [r1]        \n"
+        "mov        sp, r2          \n"
+        "vpop       {s16-s31}       \n"
+        "pop        {r4-r11, pc}    \n"
+    );
+}
+
+} // namespace Hal
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 7. Global Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 8. Static Functions
+//-----------------------------------------------------------------------------------------------------------------------------
@@ -95,6 +95,19 @@ void System::HaltDeubgger(void)
     return;
 }
 
+void System::InitCycleCounter(void)
+{
+    Utils::SetBit(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Pos, true);
+    DWT->CYCCNT = 0UL;
+    Utils::SetBit(DWT->CTRL, DWT_CTRL_CYCCNTENA_Pos, true);
+    return;
+}
+
+uint32_t System::GetCycleCount(void)
+{
+    return DWT->CYCCNT;
+}
+
 } // namespace ASch
 
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -88,3 +88,40 @@ SCENARIO ("A MCU must be reset", "[hal_system]")
         }
     }
 }
+
+SCENARIO ("Execution time is measured with the cycle counter", "[hal_system]")
+{
+    Hal_Mock::InitDwtRegisters();
+    Hal_Mock::InitCoreDebugRegisters();
+
+    GIVEN ("a HAL System class is created")
+    {
+        Hal::System system = Hal::System();
+
+        WHEN ("the cycle counter is initialised")
+        {
+            DWT->CYCCNT = 0x1234UL;
+            system.InitCycleCounter();
+
+            THEN ("TRCENA bit in DEMCR register shall be set")
+            {
+                REQUIRE (CoreDebug->DEMCR == Utils::Bit(CoreDebug_DEMCR_TRCENA_Pos));
+
+                AND_THEN ("the cycle counter shall be cleared and enabled")
+                {
+                    REQUIRE (DWT->CYCCNT == 0UL);
+                    REQUIRE (DWT->CTRL == Utils::Bit(DWT_CTRL_CYCCNTENA_Pos));
+                }
+            }
+            AND_WHEN ("the counter advances")
+            {
+                DWT->CYCCNT = 1000UL;
+
+                THEN ("the cycle count shall be returned")
+                {
+                    REQUIRE (system.GetCycleCount() == 1000UL);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,167 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    Utils_Bitset.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Bitset
+//! @brief   This is a fixed-size bitset class.
+//! 
+//! This class implements a set of bits that is stored in 32-bit words. The first set and the first clear bit are found
+//! with count-trailing-zeros word by word instead of bit by bit, so the bitset works as a fast free list or ready mask.
+
+#ifndef UTILS_BITSET_HPP_
+#define UTILS_BITSET_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Utils
+{
+
+//! @class Bitset
+//! @brief This is a fixed-size bitset class.
+//! All the bits are clear after construction. Indexes outside the bitset are ignored.
+template <std::size_t numberOfBits>
+class Bitset
+{
+    static_assert(numberOfBits > 0U, "The bitset must have at least one bit.");
+
+public:
+    /// @brief Simple constructor.
+    constexpr Bitset(void) : words{0UL} {};
+
+    /// @brief This function returns the number of bits.
+    /// @return Number of bits.
+    static constexpr std::size_t GetSize(void)
+    {
+        return numberOfBits;
+    }
+
+    /// @brief This function checks if a bit is set.
+    /// @param bit - Index of the bit.
+    /// @return True if the bit is set.
+    constexpr bool IsSet(std::size_t bit) const
+    {
+        return (bit < numberOfBits) && ((words[bit / 32U] & (1UL << (bit % 32U))) != 0UL);
+    }
+
+    /// @brief This function sets a bit.
+    /// @param bit - Index of the bit.
+    void Set(std::size_t bit)
+    {
+        if (bit < numberOfBits)
+        {
+            words[bit / 32U] |= (1UL << (bit % 32U));
+        }
+        return;
+    }
+
+    /// @brief This function clears a bit.
+    /// @param bit - Index of the bit.
+    void Clear(std::size_t bit)
+    {
+        if (bit < numberOfBits)
+        {
+            words[bit / 32U] &= ~(1UL << (bit % 32U));
+        }
+        return;
+    }
+
+    /// @brief This function clears all the bits.
+    void ClearAll(void)
+    {
+        for (std::size_t i = 0U; i < wordCount; ++i)
+        {
+            words[i] = 0UL;
+        }
+        return;
+    }
+
+    /// @brief This function returns the number of set bits.
+    /// @return Number of set bits.
+    std::size_t Count(void) const
+    {
+        std::size_t count = 0U;
+        for (std::size_t i = 0U; i < wordCount; ++i)
+        {
+            count += static_cast<std::size_t>(__builtin_popcountl(words[i]));
+        }
+        return count;
+    }
+
+    /// @brief This function finds the lowest set bit.
+    /// @return Index of the bit, or GetSize() if no bit is set.
+    std::size_t FindFirstSet(void) const
+    {
+        std::size_t word = 0U;
+        while ((word < wordCount) && (words[word] == 0UL))
+        {
+            ++word;
+        }
+        return (word < wordCount) ? ((word * 32U) + static_cast<std::size_t>(__builtin_ctzl(words[word]))) : numberOfBits;
+    }
+
+    /// @brief This function finds the lowest clear bit.
+    /// @return Index of the bit, or GetSize() if all the bits are set.
+    std::size_t FindFirstClear(void) const
+    {
+        std::size_t word = 0U;
+        while ((word < wordCount) && (words[word] == 0xFFFFFFFFUL))
+        {
+            ++word;
+        }
+
+        std::size_t bit = numberOfBits;
+        if (word < wordCount)
+        {
+            bit = (word * 32U) + static_cast<std::size_t>(__builtin_ctzl(~words[word] & 0xFFFFFFFFUL));
+        }
+        return (bit < numberOfBits) ? bit : numberOfBits;
+    }
+
+private:
+    static const std::size_t wordCount = (numberOfBits + 31U) / 32U;   //!< Number of words.
+
+    uint32_t words[wordCount];  //!< Bits in 32-bit words. Bit n is bit n % 32 of word n / 32.
+};
+
+} // namespace Utils
+
+#endif // UTILS_BITSET_HPP_
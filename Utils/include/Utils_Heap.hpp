@@ -0,0 +1,208 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    Utils_Heap.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   MinHeap
+//! @brief   This is a fixed-capacity binary min-heap class.
+//! 
+//! This class implements a priority queue in a statically sized array. The smallest element is found in constant time,
+//! and pushing and popping take logarithmic time, e.g. for timer deadlines that would otherwise need a sorted insert or a
+//! linear scan.
+
+#ifndef UTILS_HEAP_HPP_
+#define UTILS_HEAP_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <utility>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Utils
+{
+
+//! @class MinHeap
+//! @brief This is a fixed-capacity binary min-heap class.
+//! The elements are ordered with operator<. The element type must be default constructible and movable. Equal elements
+//! are popped in an unspecified order.
+template <typename ElementType, std::size_t capacity>
+class MinHeap
+{
+    static_assert(capacity > 0U, "The heap capacity must be at least one.");
+
+public:
+    /// @brief Simple constructor.
+    MinHeap(void) : elements(), size(0U) {};
+
+    /// @brief This function returns the capacity of the heap.
+    /// @return Capacity.
+    static constexpr std::size_t GetCapacity(void)
+    {
+        return capacity;
+    }
+
+    /// @brief This function returns the number of elements.
+    /// @return Number of elements.
+    constexpr std::size_t GetSize(void) const
+    {
+        return size;
+    }
+
+    /// @brief This function checks if the heap is empty.
+    /// @return True if the heap is empty.
+    constexpr bool IsEmpty(void) const
+    {
+        return (size == 0U);
+    }
+
+    /// @brief This function checks if the heap is full.
+    /// @return True if the heap is full.
+    constexpr bool IsFull(void) const
+    {
+        return (size == capacity);
+    }
+
+    /// @brief This function pushes an element into the heap. O(log n).
+    /// @param element - The element.
+    /// @return Returns true if pushing failed (i.e. heap was full)
+    bool Push(ElementType const& element)
+    {
+        bool errors = true;
+
+        if (size < capacity)
+        {
+            elements[size] = element;
+            SiftUp(size);
+            ++size;
+            errors = false;
+        }
+        return errors;
+    }
+
+    /// @brief This function pops the smallest element from the heap. O(log n).
+    /// @param element - A reference to the popped element.
+    /// @return Returns true if popping failed (i.e. heap was empty)
+    bool Pop(ElementType& element)
+    {
+        bool errors = true;
+
+        if (size > 0U)
+        {
+            element = std::move(elements[0]);
+            --size;
+            if (size > 0U)
+            {
+                elements[0] = std::move(elements[size]);
+                SiftDown(0U);
+            }
+            errors = false;
+        }
+        return errors;
+    }
+
+    /// @brief This function returns the smallest element without popping it. O(1).
+    /// @return A pointer to the element, or zero if the heap is empty.
+    ElementType const* Peek(void) const
+    {
+        return (size > 0U) ? &elements[0] : 0;
+    }
+
+    /// @brief This function removes all the elements.
+    void Clear(void)
+    {
+        size = 0U;
+        return;
+    }
+
+private:
+    /// @brief This function moves an element up until its parent is not greater than it.
+    /// @param index - Index of the element.
+    void SiftUp(std::size_t index)
+    {
+        while ((index > 0U) && (elements[index] < elements[(index - 1U) / 2U]))
+        {
+            std::swap(elements[index], elements[(index - 1U) / 2U]);
+            index = (index - 1U) / 2U;
+        }
+        return;
+    }
+
+    /// @brief This function moves an element down until its children are not less than it.
+    /// @param index - Index of the element.
+    void SiftDown(std::size_t index)
+    {
+        bool isPlaced = false;
+
+        while (isPlaced == false)
+        {
+            std::size_t smallest = index;
+            std::size_t left = (2U * index) + 1U;
+            std::size_t right = left + 1U;
+
+            if ((left < size) && (elements[left] < elements[smallest]))
+            {
+                smallest = left;
+            }
+            if ((right < size) && (elements[right] < elements[smallest]))
+            {
+                smallest = right;
+            }
+
+            if (smallest == index)
+            {
+                isPlaced = true;
+            }
+            else
+            {
+                std::swap(elements[index], elements[smallest]);
+                index = smallest;
+            }
+        }
+        return;
+    }
+
+    typedef typename IndexType<capacity>::type size_type;  //!< Size type of the heap.
+
+    ElementType elements[capacity]; //!< The heap in level order. The children of element n are 2n + 1 and 2n + 2.
+    size_type size;                 //!< Current number of elements.
+};
+
+} // namespace Utils
+
+#endif // UTILS_HEAP_HPP_
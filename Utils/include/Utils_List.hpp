@@ -0,0 +1,242 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    Utils_List.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   List
+//! @brief   This is an intrusive doubly linked list class.
+//! 
+//! The links are stored in the elements themselves: an element type derives from Utils::ListNode, so linking and
+//! unlinking never allocate memory and an element is removed in constant time without searching. An element can be in
+//! one list at a time.
+
+#ifndef UTILS_LIST_HPP_
+#define UTILS_LIST_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Utils
+{
+
+/// @brief This is the link part of an intrusive list element.
+struct ListNode
+{
+    /// @brief Simple constructor. The node is not linked.
+    constexpr ListNode(void) : pNext(0), pPrevious(0) {};
+
+    /// @brief This function checks if the node is linked into a list.
+    /// @return True if the node is linked.
+    constexpr bool IsLinked(void) const
+    {
+        return (pNext != 0);
+    }
+
+    ListNode* pNext;        //!< The next node, or the list head for the last node.
+    ListNode* pPrevious;    //!< The previous node, or the list head for the first node.
+};
+
+} // namespace Utils
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Utils
+{
+
+//! @class List
+//! @brief This is an intrusive doubly linked list class.
+//! The list is circular through a head node, so linking and unlinking have no special cases. The element type must derive
+//! from ListNode. The list does not own its elements, and it cannot be copied since the elements point to its head.
+template <typename ElementType>
+class List
+{
+public:
+    /// @brief Simple constructor.
+    List(void) : count(0U)
+    {
+        head.pNext = &head;
+        head.pPrevious = &head;
+    };
+
+    List(List const&) = delete;
+    List& operator=(List const&) = delete;
+
+    /// @brief This function returns the number of elements.
+    /// @return Number of elements.
+    constexpr std::size_t GetCount(void) const
+    {
+        return count;
+    }
+
+    /// @brief This function checks if the list is empty.
+    /// @return True if the list is empty.
+    constexpr bool IsEmpty(void) const
+    {
+        return (count == 0U);
+    }
+
+    /// @brief This function adds an element to the front of the list.
+    /// @param element - The element. Must not be linked.
+    /// @return Returns true if adding failed (i.e. the element was already linked)
+    bool PushFront(ElementType& element)
+    {
+        return Link(head, element);
+    }
+
+    /// @brief This function adds an element to the back of the list.
+    /// @param element - The element. Must not be linked.
+    /// @return Returns true if adding failed (i.e. the element was already linked)
+    bool PushBack(ElementType& element)
+    {
+        return Link(*head.pPrevious, element);
+    }
+
+    /// @brief This function inserts an element after another element of the list.
+    /// @param position - An element of the list.
+    /// @param element - The element to be inserted. Must not be linked.
+    /// @return Returns true if inserting failed (i.e. the element was already linked)
+    bool InsertAfter(ElementType& position, ElementType& element)
+    {
+        return Link(position, element);
+    }
+
+    /// @brief This function removes an element from the list. O(1).
+    /// @param element - An element of the list.
+    void Remove(ElementType& element)
+    {
+        ListNode& node = element;
+        if (node.IsLinked() == true)
+        {
+            node.pPrevious->pNext = node.pNext;
+            node.pNext->pPrevious = node.pPrevious;
+            node.pNext = 0;
+            node.pPrevious = 0;
+            --count;
+        }
+        return;
+    }
+
+    /// @brief This function removes the first element.
+    /// @return A pointer to the removed element, or zero if the list is empty.
+    ElementType* PopFront(void)
+    {
+        ElementType* pElement = GetFront();
+        if (pElement != 0)
+        {
+            Remove(*pElement);
+        }
+        return pElement;
+    }
+
+    /// @brief This function returns the first element.
+    /// @return A pointer to the element, or zero if the list is empty.
+    ElementType* GetFront(void) const
+    {
+        return ToElement(head.pNext);
+    }
+
+    /// @brief This function returns the last element.
+    /// @return A pointer to the element, or zero if the list is empty.
+    ElementType* GetBack(void) const
+    {
+        return ToElement(head.pPrevious);
+    }
+
+    /// @brief This function returns the element that follows an element of the list.
+    /// @param element - An element of the list.
+    /// @return A pointer to the next element, or zero for the last element.
+    ElementType* GetNext(ElementType const& element) const
+    {
+        return ToElement(static_cast<ListNode const&>(element).pNext);
+    }
+
+    /// @brief This function returns the element that precedes an element of the list.
+    /// @param element - An element of the list.
+    /// @return A pointer to the previous element, or zero for the first element.
+    ElementType* GetPrevious(ElementType const& element) const
+    {
+        return ToElement(static_cast<ListNode const&>(element).pPrevious);
+    }
+
+    /// @brief This function unlinks all the elements.
+    void Clear(void)
+    {
+        while (PopFront() != 0)
+        {
+            Nop();
+        }
+        return;
+    }
+
+private:
+    /// @brief This function links a node after another node.
+    /// @param position - The node after which the element is linked.
+    /// @param element - The element.
+    /// @return Returns true if the element was already linked.
+    bool Link(ListNode& position, ElementType& element)
+    {
+        bool errors = true;
+        ListNode& node = element;
+
+        if (node.IsLinked() == false)
+        {
+            node.pPrevious = &position;
+            node.pNext = position.pNext;
+            position.pNext->pPrevious = &node;
+            position.pNext = &node;
+            ++count;
+            errors = false;
+        }
+        return errors;
+    }
+
+    /// @brief This function converts a node pointer into an element pointer.
+    /// @param pNode - A pointer to the node.
+    /// @return A pointer to the element, or zero for the head.
+    ElementType* ToElement(ListNode* pNode) const
+    {
+        return (pNode == &head) ? 0 : static_cast<ElementType*>(pNode);
+    }
+
+    ListNode head;          //!< The head node that links the last element to the first one.
+    std::size_t count;      //!< Current number of elements.
+};
+
+} // namespace Utils
+
+#endif // UTILS_LIST_HPP_
@@ -0,0 +1,337 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    Utils_Pool.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   Pool
+//! @brief   This is a fixed-block memory pool class.
+//! 
+//! This class replaces dynamic allocation with a statically sized pool of equally sized blocks. Allocating and freeing
+//! take constant time, since the free blocks are linked into a stack through the blocks themselves. Several modules that
+//! do not peak at the same time can share one pool instead of each reserving its worst case.
+
+#ifndef UTILS_POOL_HPP_
+#define UTILS_POOL_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <new>
+#include <utility>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Utils
+{
+
+/// @brief This is a lock type for pools that are used from a single context only, or that are protected by the caller.
+struct NoLock
+{
+    static void Lock(void) {};
+    static void Unlock(void) {};
+};
+
+/// @brief This template keeps the allocation statistics of a pool.
+template <bool isEnabled>
+class PoolStatistics
+{
+public:
+    /// @brief Simple constructor.
+    PoolStatistics(void) : highWaterMark(0U), failureCount(0UL) {};
+
+    /// @brief This function records a successful allocation.
+    /// @param usedBlocks - Number of used blocks after the allocation.
+    void RecordAllocation(std::size_t usedBlocks)
+    {
+        if (usedBlocks > highWaterMark)
+        {
+            highWaterMark = usedBlocks;
+        }
+        return;
+    }
+
+    /// @brief This function records a failed allocation.
+    void RecordFailure(void)
+    {
+        ++failureCount;
+        return;
+    }
+
+    /// @brief This function returns the highest number of blocks that have been in use at the same time.
+    /// @return High-water mark.
+    std::size_t GetHighWaterMark(void) const
+    {
+        return highWaterMark;
+    }
+
+    /// @brief This function returns the number of allocations that failed because the pool was exhausted.
+    /// @return Number of failed allocations.
+    uint32_t GetFailureCount(void) const
+    {
+        return failureCount;
+    }
+
+    /// @brief This function resets the statistics.
+    /// @param usedBlocks - Number of blocks currently in use. The high-water mark starts from it.
+    void Reset(std::size_t usedBlocks)
+    {
+        highWaterMark = usedBlocks;
+        failureCount = 0UL;
+        return;
+    }
+
+private:
+    std::size_t highWaterMark;  //!< Highest number of used blocks.
+    uint32_t failureCount;      //!< Number of failed allocations.
+};
+
+/// @brief This is a specialisation for pools without statistics. It takes no memory and always returns zero.
+template <>
+class PoolStatistics<false>
+{
+public:
+    void RecordAllocation(std::size_t) {};
+    void RecordFailure(void) {};
+    std::size_t GetHighWaterMark(void) const { return 0U; };
+    uint32_t GetFailureCount(void) const { return 0UL; };
+    void Reset(std::size_t) {};
+};
+
+} // namespace Utils
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Utils
+{
+
+//! @class Pool
+//! @brief This is a fixed-block memory pool class.
+//! The blocks are sized and aligned for ElementType. The lock type provides static Lock() and Unlock() functions that
+//! protect the free list, e.g. by disabling interrupts when the pool is used from ISRs. The lock is held only while a
+//! block is unlinked from or linked to the free list; elements are constructed and destroyed outside of it.
+//! The pool does not track the allocated blocks, so it does not destroy the remaining elements when it is destroyed.
+template <typename ElementType, std::size_t capacity, typename LockType = NoLock, bool isStatisticsEnabled = false>
+class Pool
+{
+    static_assert(capacity > 0U, "The pool capacity must be at least one.");
+
+    typedef typename IndexType<capacity>::type index_t;     //!< Index type of the pool blocks.
+
+public:
+    /// @brief Simple constructor. All the blocks are free.
+    Pool(void) : freeHead(0U), freeCount(capacity), statistics()
+    {
+        Reset();
+    };
+
+    Pool(Pool const&) = delete;
+    Pool& operator=(Pool const&) = delete;
+
+    /// @brief This function returns the capacity of the pool.
+    /// @return Capacity.
+    static constexpr std::size_t GetCapacity(void)
+    {
+        return capacity;
+    }
+
+    /// @brief This function returns the number of free blocks.
+    /// @return Number of free blocks.
+    std::size_t GetNumberOfFree(void) const
+    {
+        return freeCount;
+    }
+
+    /// @brief This function frees all the blocks and resets the statistics, e.g. at initialisation.
+    /// The elements in the blocks are not destroyed.
+    void Reset(void)
+    {
+        LockType::Lock();
+        for (std::size_t i = 0U; i < capacity; ++i)
+        {
+            NextFree(i) = static_cast<index_t>(i + 1U);
+        }
+        freeHead = 0U;
+        freeCount = capacity;
+        statistics.Reset(0U);
+        LockType::Unlock();
+        return;
+    }
+
+    /// @brief This function allocates a block. O(1). The element in the block is not constructed.
+    /// @return A pointer to the block, or zero if the pool is exhausted.
+    ElementType* Allocate(void)
+    {
+        ElementType* pElement = 0;
+
+        LockType::Lock();
+        if (freeCount > 0U)
+        {
+            std::size_t index = freeHead;
+            freeHead = NextFree(index);
+            --freeCount;
+            statistics.RecordAllocation(capacity - freeCount);
+            pElement = reinterpret_cast<ElementType*>(&blocks[index]);
+        }
+        else
+        {
+            statistics.RecordFailure();
+        }
+        LockType::Unlock();
+
+        return pElement;
+    }
+
+    /// @brief This function frees a block. O(1). The element in the block is not destroyed.
+    /// @param pElement - A pointer to a block allocated from this pool.
+    /// @return Returns true if freeing failed (i.e. the pointer does not point to a block of this pool)
+    bool Free(ElementType* pElement)
+    {
+        bool errors = true;
+        std::size_t index = GetIndex(pElement);
+
+        if (index < capacity)
+        {
+            LockType::Lock();
+            NextFree(index) = freeHead;
+            freeHead = static_cast<index_t>(index);
+            ++freeCount;
+            LockType::Unlock();
+            errors = false;
+        }
+        return errors;
+    }
+
+    /// @brief This function allocates a block and constructs an element in it.
+    /// @param args - The constructor arguments.
+    /// @return A pointer to the element, or zero if the pool is exhausted.
+    template <typename... Args>
+    ElementType* Create(Args&&... args)
+    {
+        ElementType* pElement = Allocate();
+        if (pElement != 0)
+        {
+            new (pElement) ElementType(std::forward<Args>(args)...);
+        }
+        return pElement;
+    }
+
+    /// @brief This function destroys an element and frees its block.
+    /// @param pElement - A pointer to an element created in this pool.
+    /// @return Returns true if destroying failed (i.e. the pointer does not point to a block of this pool)
+    bool Destroy(ElementType* pElement)
+    {
+        bool errors = true;
+
+        if (GetIndex(pElement) < capacity)
+        {
+            pElement->~ElementType();
+            errors = Free(pElement);
+        }
+        return errors;
+    }
+
+    /// @brief This function returns the index of a block, e.g. to store a compact handle instead of a pointer.
+    /// @param pElement - A pointer to a block.
+    /// @return Index of the block, or the capacity if the pointer does not point to a block of this pool.
+    std::size_t GetIndex(ElementType const* pElement) const
+    {
+        std::size_t index = capacity;
+        uintptr_t address = reinterpret_cast<uintptr_t>(pElement);
+        uintptr_t first = reinterpret_cast<uintptr_t>(&blocks[0]);
+
+        if ((address >= first) && (((address - first) % sizeof(block_t)) == 0U))
+        {
+            std::size_t offset = (address - first) / sizeof(block_t);
+            if (offset < capacity)
+            {
+                index = offset;
+            }
+        }
+        return index;
+    }
+
+    /// @brief This function returns a block by its index.
+    /// @param index - Index of the block.
+    /// @return A pointer to the block, or zero if the index is out of range.
+    ElementType* GetElement(std::size_t index)
+    {
+        return (index < capacity) ? reinterpret_cast<ElementType*>(&blocks[index]) : 0;
+    }
+
+    /// @brief This function returns the highest number of blocks that have been in use at the same time.
+    /// @return High-water mark, or zero if the statistics are disabled.
+    std::size_t GetHighWaterMark(void) const
+    {
+        return statistics.GetHighWaterMark();
+    }
+
+    /// @brief This function returns the number of allocations that failed because the pool was exhausted.
+    /// @return Number of failed allocations, or zero if the statistics are disabled.
+    uint32_t GetFailureCount(void) const
+    {
+        return statistics.GetFailureCount();
+    }
+
+    /// @brief This function resets the statistics.
+    void ResetStatistics(void)
+    {
+        LockType::Lock();
+        statistics.Reset(capacity - freeCount);
+        LockType::Unlock();
+        return;
+    }
+
+private:
+    /// @brief A block holds either an element or, while it is free, the index of the next free block.
+    typedef typename std::aligned_storage<((sizeof(ElementType) > sizeof(index_t)) ? sizeof(ElementType) : sizeof(index_t)),
+                                          ((alignof(ElementType) > alignof(index_t)) ? alignof(ElementType) : alignof(index_t))>::type block_t;
+
+    /// @brief This function returns the free list link stored in a free block.
+    /// @param index - Index of the block.
+    /// @return A reference to the index of the next free block.
+    index_t& NextFree(std::size_t index)
+    {
+        return *reinterpret_cast<index_t*>(&blocks[index]);
+    }
+
+    block_t blocks[capacity];                           //!< The pool blocks.
+    index_t freeHead;                                   //!< Index of the first free block.
+    index_t freeCount;                                  //!< Number of free blocks.
+    PoolStatistics<isStatisticsEnabled> statistics;     //!< Allocation statistics.
+};
+
+} // namespace Utils
+
+#endif // UTILS_POOL_HPP_
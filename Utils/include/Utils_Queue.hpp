@@ -25,6 +25,8 @@
 //! @brief   This is a generic queue class.
 //! 
 //! This class implements a simple general purpose ring-buffer type queue that operates in FIFO method.
+//! The elements are constructed in place in the queue storage, so element types that are not trivially copyable are
+//! supported as well. Queues with a power-of-two size wrap their indexes with a mask instead of a comparison.
 
 #ifndef UTILS_QUEUE_HPP_
 #define UTILS_QUEUE_HPP_
@@ -35,11 +37,128 @@
 
 #include <Utils_Types.hpp>
 #include <Utils_Misc.hpp>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // 2. Typedefs, Structs, Enums and Constants
 //-----------------------------------------------------------------------------------------------------------------------------
 
+namespace Utils
+{
+
+/// @brief This template wraps the ring-buffer indexes of a queue with a comparison.
+template <std::size_t size, bool isPowerOfTwo = ((size & (size - 1U)) == 0U)>
+struct QueueIndex
+{
+    /// @brief This function returns the index that follows the given index.
+    /// @param index - The index.
+    /// @return The next index.
+    template <typename IntType>
+    static IntType Next(IntType index)
+    {
+        ++index;
+        return (index >= size) ? static_cast<IntType>(0U) : index;
+    }
+
+    /// @brief This function returns the index that is the given offset after the given index.
+    /// @param index - The index.
+    /// @param offset - The offset. Must be less than the queue size.
+    /// @return The offset index.
+    template <typename IntType>
+    static IntType Add(IntType index, std::size_t offset)
+    {
+        std::size_t sum = static_cast<std::size_t>(index) + offset;
+        return static_cast<IntType>((sum >= size) ? (sum - size) : sum);
+    }
+};
+
+/// @brief This is a specialisation for power-of-two sizes that wraps the indexes with a mask.
+template <std::size_t size>
+struct QueueIndex<size, true>
+{
+    template <typename IntType>
+    static IntType Next(IntType index)
+    {
+        return static_cast<IntType>((index + 1U) & (size - 1U));
+    }
+
+    template <typename IntType>
+    static IntType Add(IntType index, std::size_t offset)
+    {
+        return static_cast<IntType>((index + offset) & (size - 1U));
+    }
+};
+
+/// @brief This is the element storage of a queue. The destructor is trivial, so a static queue of trivially destructible
+/// elements needs no destructor registration.
+template <typename ElementType, std::size_t size>
+class QueueSlots
+{
+protected:
+    typedef typename IndexType<size>::type index_t;    //!< Index and count type of the queue.
+    typedef QueueIndex<size> Index;                     //!< Index arithmetic of the queue.
+    typedef typename std::aligned_storage<sizeof(ElementType), alignof(ElementType)>::type slot_t; //!< Element storage type.
+
+    QueueSlots(void) :
+        numberOfElements(0U),
+        nextFreeIndex(0U),
+        nextIndexInQueue(0U)
+    {
+    }
+
+    /// @brief This function returns a pointer to the element in a slot.
+    /// @param index - Index of the slot.
+    /// @return A pointer to the element.
+    ElementType* GetElement(index_t index)
+    {
+        return reinterpret_cast<ElementType*>(&slots[index]);
+    }
+
+    /// @brief This function returns a pointer to the element in a slot.
+    /// @param index - Index of the slot.
+    /// @return A pointer to the element.
+    ElementType const* GetElement(index_t index) const
+    {
+        return reinterpret_cast<ElementType const*>(&slots[index]);
+    }
+
+    slot_t slots[size];             //!< A list of element slots.
+
+    index_t numberOfElements;       //!< Current number of elements in the queue.
+    index_t nextFreeIndex;          //!< The next free index in the queue array.
+    index_t nextIndexInQueue;       //!< Index of the next item in the queue to be popped.
+};
+
+/// @brief This template adds the destruction of the queued elements to the storage of element types that need it.
+template <typename ElementType, std::size_t size,
+          bool isTriviallyDestructible = std::is_trivially_destructible<ElementType>::value>
+class QueueStorage : protected QueueSlots<ElementType, size>
+{
+protected:
+    /// @brief Destructor. The queued elements are destroyed.
+    ~QueueStorage(void)
+    {
+        typedef QueueSlots<ElementType, size> Slots;
+        typename Slots::index_t index = this->nextIndexInQueue;
+
+        for (typename Slots::index_t i = 0U; i < this->numberOfElements; ++i)
+        {
+            this->GetElement(index)->~ElementType();
+            index = Slots::Index::Next(index);
+        }
+    }
+};
+
+/// @brief This is a specialisation for trivially destructible element types that keeps the destructor trivial.
+template <typename ElementType, std::size_t size>
+class QueueStorage<ElementType, size, true> : protected QueueSlots<ElementType, size>
+{
+};
+
+} // namespace Utils
+
 //-----------------------------------------------------------------------------------------------------------------------------
 // 3. Inline Functions
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -58,56 +177,144 @@ namespace Utils
 //! @class Queue
 //! @brief This is a generic queue class.
 //! This class implements a simple general purpose ring-buffer type queue that operates in FIFO method.
+//! The index type is chosen from the size of the queue. The elements are constructed when they are pushed and destroyed
+//! when they are popped. The queued elements are destroyed with the queue unless they are trivially destructible.
 template <typename ElementType, std::size_t size>
-class Queue
+class Queue : private QueueStorage<ElementType, size>
 {
+    static_assert(size > 0U, "The queue size must be at least one.");
+
 public:
     /// @brief Simple constructor.
     Queue(void);
 
+    /// @brief Copy constructor. The queued elements are copied.
+    /// @param other - The queue to copy.
+    Queue(Queue const& other);
+
+    Queue& operator=(Queue const&) = delete;
+
     /// @brief This function pushes an element into the queue.
     /// @param element - Element to be pushed.
-    bool Push(ElementType element);
+    /// @return Returns true if pushing failed (i.e. queue was full)
+    bool Push(ElementType const& element);
+
+    /// @brief This function moves an element into the queue.
+    /// @param element - Element to be pushed.
+    /// @return Returns true if pushing failed (i.e. queue was full)
+    bool Push(ElementType&& element);
+
+    /// @brief This function constructs an element in place at the end of the queue.
+    /// @param args - The constructor arguments of the element.
+    /// @return Returns true if pushing failed (i.e. queue was full)
+    template <typename... Args>
+    bool Emplace(Args&&... args);
 
     /// @brief This function pops an element from the queue.
     /// @param element - A reference to the element to be popped.
     /// @return Returns true if popping failed (i.e. queue was empty)
     bool Pop(ElementType& element);
+
+    /// @brief This function returns a pointer to the next element in the queue without popping it. The element may be
+    /// modified in place.
+    /// @return A pointer to the element, or zero if the queue is empty.
+    ElementType* Peek(void);
+
+    /// @brief This function returns a pointer to the next element in the queue without popping it.
+    /// @return A pointer to the element, or zero if the queue is empty.
+    ElementType const* Peek(void) const;
+
+    /// @brief This function pushes as many elements of a list into the queue as fit.
+    /// @param pElements - A pointer to the elements.
+    /// @param count - Number of elements in the list.
+    /// @return Number of pushed elements.
+    std::size_t PushBatch(ElementType const* pElements, std::size_t count);
+
+    /// @brief This function pops up to the given number of elements from the queue.
+    /// @param pElements - A pointer to the storage of the popped elements.
+    /// @param count - Maximum number of elements to pop.
+    /// @return Number of popped elements.
+    std::size_t PopBatch(ElementType* pElements, std::size_t count);
     
     /// @brief This function returns the number of elements in the queue.
     /// @return Number of elements
-    uint8_t GetNumberOfElements(void) const;
+    std::size_t GetNumberOfElements(void) const;
+
+    /// @brief This function checks if an equal element is already in the queue.
+    /// The element type must provide an equality operator.
+    /// @param element - The element to be searched for.
+    /// @return True if an equal element is in the queue.
+    bool Contains(ElementType const& element) const;
+
+    /// @brief This function checks if an equal element is among the newest elements of the queue. The scan is bounded
+    /// by the given count, so the check takes a known time.
+    /// @param element - The element to be searched for.
+    /// @param maxElements - Maximum number of the newest elements to compare.
+    /// @return True if an equal element is among the compared elements.
+    bool Contains(ElementType const& element, std::size_t maxElements) const;
     
-    /// @brief This function flushes the queue.
+    /// @brief This function flushes the queue. The queued elements are destroyed.
     void Flush(void);
 
 private:
-    ElementType elements[size];     //!< A list of elements.
-    std::size_t queueSize = size;   //!< Queue maximum size.
+    typedef QueueSlots<ElementType, size> Slots;        //!< Element storage of the queue.
+    typedef typename Slots::index_t index_t;            //!< Index and count type of the queue.
+    typedef typename Slots::Index Index;                //!< Index arithmetic of the queue.
 
-    uint8_t numberOfElements;       //!< Current number of elements in the queue.
-    uint8_t nextFreeIndex;          //!< The next free index in the queue array.
-    uint8_t nextIndexInQueue;       //!< Index of the next item in the queue to be popped.
+    using Slots::GetElement;
+    using Slots::slots;
+    using Slots::numberOfElements;
+    using Slots::nextFreeIndex;
+    using Slots::nextIndexInQueue;
+
+    /// @brief This function destroys the next element and removes it from the queue.
+    void RemoveNext(void);
 };
 
 template <typename ElementType, std::size_t size>
 Queue<ElementType, size>::Queue(void)
 {
-    this->Flush();
+    return;
+}
+
+template <typename ElementType, std::size_t size>
+Queue<ElementType, size>::Queue(Queue const& other) :
+    QueueStorage<ElementType, size>()
+{
+    index_t index = other.nextIndexInQueue;
+
+    for (index_t i = 0U; i < other.numberOfElements; ++i)
+    {
+        (void)Push(*other.GetElement(index));
+        index = Index::Next(index);
+    }
 
     return;
 }
 
 template <typename ElementType, std::size_t size>
-bool Queue<ElementType, size>::Push(ElementType element)
+bool Queue<ElementType, size>::Push(ElementType const& element)
+{
+    return Emplace(element);
+}
+
+template <typename ElementType, std::size_t size>
+bool Queue<ElementType, size>::Push(ElementType&& element)
+{
+    return Emplace(std::move(element));
+}
+
+template <typename ElementType, std::size_t size>
+template <typename... Args>
+bool Queue<ElementType, size>::Emplace(Args&&... args)
 {
     bool errors;
 
-    if (numberOfElements < queueSize)
+    if (numberOfElements < size)
     {
-        elements[nextFreeIndex] = element;
+        new (&slots[nextFreeIndex]) ElementType(std::forward<Args>(args)...);
         numberOfElements++;
-        IncrementIndexWithRollover(nextFreeIndex, queueSize);
+        nextFreeIndex = Index::Next(nextFreeIndex);
 
         errors = false;
     }
@@ -126,9 +333,8 @@ bool Queue<ElementType, size>::Pop(ElementType& element)
 
     if (numberOfElements > 0U)
     {
-        element = elements[nextIndexInQueue];
-        IncrementIndexWithRollover(nextIndexInQueue, queueSize);
-        numberOfElements--;
+        element = std::move(*GetElement(nextIndexInQueue));
+        RemoveNext();
 
         errors = false;
     }
@@ -141,21 +347,228 @@ bool Queue<ElementType, size>::Pop(ElementType& element)
 }
 
 template <typename ElementType, std::size_t size>
-uint8_t Queue<ElementType, size>::GetNumberOfElements(void) const
+ElementType* Queue<ElementType, size>::Peek(void)
+{
+    return (numberOfElements > 0U) ? GetElement(nextIndexInQueue) : 0;
+}
+
+template <typename ElementType, std::size_t size>
+ElementType const* Queue<ElementType, size>::Peek(void) const
+{
+    return (numberOfElements > 0U) ? GetElement(nextIndexInQueue) : 0;
+}
+
+template <typename ElementType, std::size_t size>
+std::size_t Queue<ElementType, size>::PushBatch(ElementType const* pElements, std::size_t count)
+{
+    std::size_t freeSlots = size - numberOfElements;
+    std::size_t pushed = (count < freeSlots) ? count : freeSlots;
+
+    for (std::size_t i = 0U; i < pushed; ++i)
+    {
+        new (&slots[Index::Add(nextFreeIndex, i)]) ElementType(pElements[i]);
+    }
+    nextFreeIndex = Index::Add(nextFreeIndex, pushed);
+    numberOfElements = static_cast<index_t>(numberOfElements + pushed);
+
+    return pushed;
+}
+
+template <typename ElementType, std::size_t size>
+std::size_t Queue<ElementType, size>::PopBatch(ElementType* pElements, std::size_t count)
+{
+    std::size_t popped = (count < numberOfElements) ? count : numberOfElements;
+
+    for (std::size_t i = 0U; i < popped; ++i)
+    {
+        pElements[i] = std::move(*GetElement(nextIndexInQueue));
+        RemoveNext();
+    }
+
+    return popped;
+}
+
+template <typename ElementType, std::size_t size>
+std::size_t Queue<ElementType, size>::GetNumberOfElements(void) const
 {
     return numberOfElements;
 }
 
+template <typename ElementType, std::size_t size>
+bool Queue<ElementType, size>::Contains(ElementType const& element) const
+{
+    return Contains(element, size);
+}
+
+template <typename ElementType, std::size_t size>
+bool Queue<ElementType, size>::Contains(ElementType const& element, std::size_t maxElements) const
+{
+    bool isFound = false;
+    std::size_t count = (maxElements < numberOfElements) ? maxElements : static_cast<std::size_t>(numberOfElements);
+    index_t index = Index::Add(nextIndexInQueue, numberOfElements - count);
+
+    for (std::size_t i = 0U; (i < count) && (isFound == false); ++i)
+    {
+        isFound = (*GetElement(index) == element);
+        index = Index::Next(index);
+    }
+
+    return isFound;
+}
+
 template <typename ElementType, std::size_t size>
 void Queue<ElementType, size>::Flush(void)
 {
-    numberOfElements = 0U;
+    while (numberOfElements > 0U)
+    {
+        RemoveNext();
+    }
     nextFreeIndex = 0U;
     nextIndexInQueue = 0U;
 
     return;
 }
 
+template <typename ElementType, std::size_t size>
+void Queue<ElementType, size>::RemoveNext(void)
+{
+    GetElement(nextIndexInQueue)->~ElementType();
+    nextIndexInQueue = Index::Next(nextIndexInQueue);
+    numberOfElements--;
+
+    return;
+}
+
+//! @class QueueView
+//! @brief This is a ring-buffer queue over storage that is given by the owner.
+//! The queue works in FIFO method like Queue, but the size is chosen at run time. The elements are copied in and out,
+//! so the element type must be copy assignable.
+template <typename ElementType>
+class QueueView
+{
+public:
+    /// @brief Simple constructor. The queue has no storage until it is attached to one.
+    QueueView(void);
+
+    /// @brief Constructor.
+    /// @param pStorage - A pointer to the element storage.
+    /// @param size - Number of elements in the storage.
+    QueueView(ElementType* pStorage, std::size_t size);
+
+    /// @brief This function pushes an element into the queue.
+    /// @param element - Element to be pushed.
+    /// @return Returns true if pushing failed (i.e. queue was full)
+    bool Push(ElementType const& element);
+
+    /// @brief This function pops an element from the queue.
+    /// @param element - A reference to the element to be popped.
+    /// @return Returns true if popping failed (i.e. queue was empty)
+    bool Pop(ElementType& element);
+
+    /// @brief This function returns the number of elements in the queue.
+    /// @return Number of elements
+    std::size_t GetNumberOfElements(void) const;
+
+    /// @brief This function returns the number of elements that fit into the queue.
+    /// @return Size of the queue.
+    std::size_t GetSize(void) const;
+
+    /// @brief This function flushes the queue.
+    void Flush(void);
+
+private:
+    ElementType* pElements;         //!< A pointer to the element storage.
+    std::size_t size;               //!< Number of elements in the storage.
+    volatile std::size_t numberOfElements;  //!< Current number of elements in the queue.
+    std::size_t nextFreeIndex;      //!< The next free index in the storage.
+    std::size_t nextIndexInQueue;   //!< Index of the next item in the queue to be popped.
+};
+
+template <typename ElementType>
+QueueView<ElementType>::QueueView(void) :
+    pElements(0),
+    size(0U),
+    numberOfElements(0U),
+    nextFreeIndex(0U),
+    nextIndexInQueue(0U)
+{
+    return;
+}
+
+template <typename ElementType>
+QueueView<ElementType>::QueueView(ElementType* pStorage, std::size_t size) :
+    pElements(pStorage),
+    size((pStorage != 0) ? size : 0U),
+    numberOfElements(0U),
+    nextFreeIndex(0U),
+    nextIndexInQueue(0U)
+{
+    return;
+}
+
+template <typename ElementType>
+bool QueueView<ElementType>::Push(ElementType const& element)
+{
+    bool errors;
+
+    if (numberOfElements < size)
+    {
+        pElements[nextFreeIndex] = element;
+        numberOfElements = numberOfElements + 1U;
+        IncrementIndexWithRollover(nextFreeIndex, size);
+
+        errors = false;
+    }
+    else
+    {
+        errors = true;
+    }
+
+    return errors;
+}
+
+template <typename ElementType>
+bool QueueView<ElementType>::Pop(ElementType& element)
+{
+    bool errors;
+
+    if (numberOfElements > 0U)
+    {
+        element = pElements[nextIndexInQueue];
+        IncrementIndexWithRollover(nextIndexInQueue, size);
+        numberOfElements = numberOfElements - 1U;
+
+        errors = false;
+    }
+    else
+    {
+        errors = true;
+    }
+
+    return errors;
+}
+
+template <typename ElementType>
+std::size_t QueueView<ElementType>::GetNumberOfElements(void) const
+{
+    return numberOfElements;
+}
+
+template <typename ElementType>
+std::size_t QueueView<ElementType>::GetSize(void) const
+{
+    return size;
+}
+
+template <typename ElementType>
+void QueueView<ElementType>::Flush(void)
+{
+    numberOfElements = 0U;
+    nextFreeIndex = 0U;
+    nextIndexInQueue = 0U;
+    return;
+}
+
 } // namespace Utils
 
 #endif // UTILS_QUEUE_HPP_
@@ -0,0 +1,257 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    Utils_StaticVector.hpp
+//! @author  Juho Lepistö <juho.lepisto(a)gmail.com>
+//! @date    18 Oct 2026
+//!
+//! @class   StaticVector
+//! @brief   This is a fixed-capacity vector class.
+//! 
+//! This class implements a vector that keeps its elements in statically sized storage, i.e. it never uses the heap. The
+//! elements are constructed in place when they are added and destroyed when they are removed. EraseUnordered removes an
+//! element in constant time by moving the last element into its place.
+
+#ifndef UTILS_STATICVECTOR_HPP_
+#define UTILS_STATICVECTOR_HPP_
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Dependencies
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#include <Utils_Types.hpp>
+#include <new>
+#include <utility>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Typedefs, Structs, Enums and Constants
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Inline Functions
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 4. Global Function Prototypes
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 5. Class Declaration
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace Utils
+{
+
+//! @class StaticVector
+//! @brief This is a fixed-capacity vector class.
+//! The elements are contiguous and can be iterated with begin() and end(). The size type is chosen from the capacity.
+template <typename ElementType, std::size_t capacity>
+class StaticVector
+{
+    static_assert(capacity > 0U, "The vector capacity must be at least one.");
+
+public:
+    /// @brief Simple constructor.
+    StaticVector(void) : size(0U) {};
+
+    /// @brief Copy constructor. The elements are copied.
+    /// @param other - The vector to copy.
+    StaticVector(StaticVector const& other) : size(0U)
+    {
+        for (size_type i = 0U; i < other.size; ++i)
+        {
+            (void)PushBack(other[i]);
+        }
+    };
+
+    /// @brief Destructor. The elements are destroyed.
+    ~StaticVector(void)
+    {
+        Clear();
+    };
+
+    StaticVector& operator=(StaticVector const&) = delete;
+
+    /// @brief This function returns the capacity of the vector.
+    /// @return Capacity.
+    static constexpr std::size_t GetCapacity(void)
+    {
+        return capacity;
+    }
+
+    /// @brief This function returns the number of elements.
+    /// @return Number of elements.
+    constexpr std::size_t GetSize(void) const
+    {
+        return size;
+    }
+
+    /// @brief This function checks if the vector is empty.
+    /// @return True if the vector is empty.
+    constexpr bool IsEmpty(void) const
+    {
+        return (size == 0U);
+    }
+
+    /// @brief This function checks if the vector is full.
+    /// @return True if the vector is full.
+    constexpr bool IsFull(void) const
+    {
+        return (size == capacity);
+    }
+
+    /// @brief This function adds an element to the end of the vector.
+    /// @param element - The element.
+    /// @return Returns true if adding failed (i.e. vector was full)
+    bool PushBack(ElementType const& element)
+    {
+        return EmplaceBack(element);
+    }
+
+    /// @brief This function constructs an element in place at the end of the vector.
+    /// @param args - The constructor arguments of the element.
+    /// @return Returns true if adding failed (i.e. vector was full)
+    template <typename... Args>
+    bool EmplaceBack(Args&&... args)
+    {
+        bool errors = true;
+
+        if (size < capacity)
+        {
+            new (&slots[size]) ElementType(std::forward<Args>(args)...);
+            ++size;
+            errors = false;
+        }
+        return errors;
+    }
+
+    /// @brief This function removes the last element.
+    void PopBack(void)
+    {
+        if (size > 0U)
+        {
+            --size;
+            (*this)[size].~ElementType();
+        }
+        return;
+    }
+
+    /// @brief This function removes an element and shifts the following elements to keep the order. O(n).
+    /// @param index - Index of the element.
+    void Erase(std::size_t index)
+    {
+        if (index < size)
+        {
+            for (std::size_t i = index + 1U; i < size; ++i)
+            {
+                (*this)[i - 1U] = std::move((*this)[i]);
+            }
+            PopBack();
+        }
+        return;
+    }
+
+    /// @brief This function removes an element by moving the last element into its place. O(1), but the order of the
+    /// elements is not kept.
+    /// @param index - Index of the element.
+    void EraseUnordered(std::size_t index)
+    {
+        if (index < size)
+        {
+            if (index != (size - 1U))
+            {
+                (*this)[index] = std::move((*this)[size - 1U]);
+            }
+            PopBack();
+        }
+        return;
+    }
+
+    /// @brief This function finds the first element that is equal to the given element.
+    /// The element type must provide an equality operator.
+    /// @param element - The element to be searched for.
+    /// @return Index of the element, or the size of the vector if the element is not found.
+    std::size_t Find(ElementType const& element) const
+    {
+        std::size_t index = 0U;
+        while ((index < size) && (((*this)[index] == element) == false))
+        {
+            ++index;
+        }
+        return index;
+    }
+
+    /// @brief This function removes all the elements.
+    void Clear(void)
+    {
+        while (size > 0U)
+        {
+            PopBack();
+        }
+        return;
+    }
+
+    /// @brief This function returns a reference to an element. The index must be less than the size.
+    /// @param index - Index of the element.
+    /// @return A reference to the element.
+    ElementType& operator[](std::size_t index)
+    {
+        return *reinterpret_cast<ElementType*>(&slots[index]);
+    }
+
+    /// @brief This function returns a reference to an element. The index must be less than the size.
+    /// @param index - Index of the element.
+    /// @return A reference to the element.
+    ElementType const& operator[](std::size_t index) const
+    {
+        return *reinterpret_cast<ElementType const*>(&slots[index]);
+    }
+
+    /// @brief These functions return iterators to the first and past the last element.
+    ElementType* begin(void)
+    {
+        return reinterpret_cast<ElementType*>(&slots[0]);
+    }
+
+    ElementType* end(void)
+    {
+        return begin() + size;
+    }
+
+    ElementType const* begin(void) const
+    {
+        return reinterpret_cast<ElementType const*>(&slots[0]);
+    }
+
+    ElementType const* end(void) const
+    {
+        return begin() + size;
+    }
+
+private:
+    typedef typename IndexType<capacity>::type size_type;  //!< Size type of the vector.
+    typedef typename std::aligned_storage<sizeof(ElementType), alignof(ElementType)>::type slot_t; //!< Element storage type.
+
+    slot_t slots[capacity];     //!< A list of element slots.
+    size_type size;             //!< Current number of elements.
+};
+
+} // namespace Utils
+
+#endif // UTILS_STATICVECTOR_HPP_
@@ -31,11 +31,29 @@
 //-----------------------------------------------------------------------------------------------------------------------------
 
 #include <cstdint>
+#include <cstddef>
+#include <type_traits>
 
 //-----------------------------------------------------------------------------------------------------------------------------
 // 2. Typedefs, Structs, Enums and Constants
 //-----------------------------------------------------------------------------------------------------------------------------
 
+namespace Utils
+{
+
+/// @brief This template selects the smallest unsigned type that holds the indexes and the count of a list of the given
+/// capacity, i.e. the values from zero to the capacity. Small lists get 8-bit types.
+template <std::size_t capacity>
+struct IndexType
+{
+    static_assert(capacity <= 0xFFFFFFFFUL, "The capacity does not fit into a 32-bit index type.");
+
+    typedef typename std::conditional<(capacity <= 0xFFU), uint8_t,
+                     typename std::conditional<(capacity <= 0xFFFFU), uint16_t, uint32_t>::type>::type type;
+};
+
+} // namespace Utils
+
 #if (UNIT_TEST == 1)
     #define static_mf       static //!< When unit testing static_mf functions convert into virtual functions to enable mocking.
 #else
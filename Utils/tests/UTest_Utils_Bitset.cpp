@@ -0,0 +1,175 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_Utils_Bitset.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for Utils_Bitset.hpp
+//! 
+//! The benchmark test case is hidden and is run with the [.benchmark] tag.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <fakeit.hpp>
+
+#include <Utils_Bitset.hpp>
+
+#include <chrono>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+static const std::size_t benchmarkSize = 256U;
+static const uint32_t benchmarkRounds = 100000UL;
+
+// Reference implementation of FindFirstSet that tests the bits one by one.
+template <std::size_t size>
+std::size_t FindFirstSetLinear(Utils::Bitset<size> const& bitset)
+{
+    std::size_t bit = 0U;
+    while ((bit < size) && (bitset.IsSet(bit) == false))
+    {
+        ++bit;
+    }
+    return bit;
+}
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer uses a bitset", "[bitset]")
+{
+    GIVEN ("a bitset spanning several words is created")
+    {
+        Utils::Bitset<70U> bitset;
+
+        THEN ("all the bits shall be clear")
+        {
+            static_assert(Utils::Bitset<70U>::GetSize() == 70U, "Size is not constexpr.");
+            REQUIRE (bitset.Count() == 0U);
+            REQUIRE (bitset.FindFirstSet() == 70U);
+            REQUIRE (bitset.FindFirstClear() == 0U);
+        }
+
+        WHEN ("bits are set in different words")
+        {
+            bitset.Set(69U);
+            bitset.Set(33U);
+            bitset.Set(0U);
+
+            THEN ("they shall be set and counted")
+            {
+                REQUIRE (bitset.IsSet(0U) == true);
+                REQUIRE (bitset.IsSet(33U) == true);
+                REQUIRE (bitset.IsSet(69U) == true);
+                REQUIRE (bitset.IsSet(1U) == false);
+                REQUIRE (bitset.Count() == 3U);
+                REQUIRE (bitset.FindFirstSet() == 0U);
+                REQUIRE (bitset.FindFirstClear() == 1U);
+            }
+
+            AND_WHEN ("the first bits are cleared")
+            {
+                bitset.Clear(0U);
+                bitset.Clear(33U);
+
+                THEN ("the first set bit shall be found in the last word")
+                {
+                    REQUIRE (bitset.Count() == 1U);
+                    REQUIRE (bitset.FindFirstSet() == 69U);
+                }
+            }
+
+            AND_WHEN ("all the bits are cleared")
+            {
+                bitset.ClearAll();
+
+                THEN ("no bits shall be set")
+                {
+                    REQUIRE (bitset.Count() == 0U);
+                    REQUIRE (bitset.FindFirstSet() == 70U);
+                }
+            }
+        }
+
+        WHEN ("all the bits are set")
+        {
+            for (std::size_t bit = 0U; bit < 70U; ++bit)
+            {
+                bitset.Set(bit);
+            }
+
+            THEN ("no clear bit shall be found")
+            {
+                REQUIRE (bitset.Count() == 70U);
+                REQUIRE (bitset.FindFirstClear() == 70U);
+            }
+        }
+
+        WHEN ("out of range bits are accessed")
+        {
+            bitset.Set(70U);
+            bitset.Clear(70U);
+
+            THEN ("nothing shall happen")
+            {
+                REQUIRE (bitset.Count() == 0U);
+                REQUIRE (bitset.IsSet(70U) == false);
+            }
+        }
+    }
+}
+
+TEST_CASE ("Bitset search benchmark", "[.benchmark]")
+{
+    Utils::Bitset<benchmarkSize> bitset;
+    std::size_t checksum = 0U;
+
+    bitset.Set(benchmarkSize - 1U);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        checksum += FindFirstSetLinear(bitset);
+    }
+    auto linear = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        checksum += bitset.FindFirstSet();
+    }
+    auto wordwise = std::chrono::steady_clock::now() - start;
+
+    WARN ("Bit by bit search: " << std::chrono::duration_cast<std::chrono::microseconds>(linear).count() << " us");
+    WARN ("FindFirstSet: " << std::chrono::duration_cast<std::chrono::microseconds>(wordwise).count() << " us");
+    REQUIRE (checksum == (2U * benchmarkRounds * (benchmarkSize - 1U)));
+}
@@ -0,0 +1,187 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_Utils_Heap.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for Utils_Heap.hpp
+//! 
+//! The benchmark test case is hidden and is run with the [.benchmark] tag.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <fakeit.hpp>
+
+#include <Utils_Heap.hpp>
+
+#include <chrono>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+typedef struct
+{
+    uint32_t deadline;
+    uint32_t id;
+} testTimer_t;
+
+bool operator<(testTimer_t const& lhs, testTimer_t const& rhs)
+{
+    return (lhs.deadline < rhs.deadline);
+}
+
+static const std::size_t benchmarkSize = 128U;
+static const uint32_t benchmarkRounds = 50000UL;
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer uses a min-heap", "[heap]")
+{
+    GIVEN ("a heap is created")
+    {
+        Utils::MinHeap<testTimer_t, 5U> heap;
+        testTimer_t timer = {0UL, 0UL};
+
+        THEN ("it shall be empty")
+        {
+            static_assert(Utils::MinHeap<testTimer_t, 5U>::GetCapacity() == 5U, "Capacity is not constexpr.");
+            REQUIRE (heap.IsEmpty() == true);
+            REQUIRE (heap.Peek() == 0);
+            REQUIRE (heap.Pop(timer) == true);
+        }
+
+        WHEN ("elements are pushed in arbitrary order")
+        {
+            bool errors = heap.Push({30UL, 1UL});
+            errors |= heap.Push({10UL, 2UL});
+            errors |= heap.Push({50UL, 3UL});
+            errors |= heap.Push({20UL, 4UL});
+            errors |= heap.Push({40UL, 5UL});
+
+            THEN ("there shall be no errors and the smallest element shall be on top")
+            {
+                REQUIRE (errors == false);
+                REQUIRE (heap.IsFull() == true);
+                REQUIRE (heap.Peek()->id == 2UL);
+            }
+
+            AND_WHEN ("one more element is pushed")
+            {
+                errors = heap.Push({0UL, 6UL});
+
+                THEN ("an error shall be returned and the heap shall not change")
+                {
+                    REQUIRE (errors == true);
+                    REQUIRE (heap.GetSize() == 5U);
+                    REQUIRE (heap.Peek()->id == 2UL);
+                }
+            }
+
+            AND_WHEN ("all the elements are popped")
+            {
+                uint32_t deadlines[5];
+                for (uint32_t i = 0UL; i < 5UL; ++i)
+                {
+                    errors |= heap.Pop(timer);
+                    deadlines[i] = timer.deadline;
+                }
+
+                THEN ("they shall come out in ascending order")
+                {
+                    REQUIRE (errors == false);
+                    REQUIRE (heap.IsEmpty() == true);
+                    REQUIRE (deadlines[0] == 10UL);
+                    REQUIRE (deadlines[1] == 20UL);
+                    REQUIRE (deadlines[2] == 30UL);
+                    REQUIRE (deadlines[3] == 40UL);
+                    REQUIRE (deadlines[4] == 50UL);
+                }
+            }
+
+            AND_WHEN ("the heap is cleared")
+            {
+                heap.Clear();
+
+                THEN ("it shall be empty")
+                {
+                    REQUIRE (heap.IsEmpty() == true);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE ("Heap minimum benchmark", "[.benchmark]")
+{
+    Utils::MinHeap<uint32_t, benchmarkSize> heap;
+    uint32_t array[benchmarkSize];
+    uint32_t seed = 12345UL;
+    uint32_t checksum = 0UL;
+
+    for (std::size_t i = 0U; i < benchmarkSize; ++i)
+    {
+        seed = (seed * 1103515245UL) + 12345UL;
+        array[i] = seed;
+        heap.Push(seed);
+    }
+
+    // Pop the minimum and push a new value, as a timer list does when a timer expires and is rescheduled.
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        uint32_t minimum;
+        heap.Pop(minimum);
+        checksum += minimum;
+        heap.Push(minimum + round);
+    }
+    auto heapTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        std::size_t minimum = 0U;
+        for (std::size_t i = 1U; i < benchmarkSize; ++i)
+        {
+            if (array[i] < array[minimum])
+            {
+                minimum = i;
+            }
+        }
+        checksum -= array[minimum];
+        array[minimum] += round;
+    }
+    auto scanTime = std::chrono::steady_clock::now() - start;
+
+    WARN ("MinHeap pop and push: " << std::chrono::duration_cast<std::chrono::microseconds>(heapTime).count() << " us");
+    WARN ("Linear scan: " << std::chrono::duration_cast<std::chrono::microseconds>(scanTime).count() << " us");
+    REQUIRE (checksum == 0UL);
+}
@@ -0,0 +1,211 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_Utils_List.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for Utils_List.hpp
+//! 
+//! The benchmark test case is hidden and is run with the [.benchmark] tag.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <fakeit.hpp>
+
+#include <Utils_List.hpp>
+
+#include <chrono>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+struct TestElement : public Utils::ListNode
+{
+    TestElement(void) : Utils::ListNode(), number(0UL) {};
+
+    TestElement(uint32_t value) : Utils::ListNode(), number(value) {};
+
+    uint32_t number;
+};
+
+static const std::size_t benchmarkSize = 200U;
+static const uint32_t benchmarkRounds = 20000UL;
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer uses an intrusive list", "[list]")
+{
+    GIVEN ("a list and three unlinked elements")
+    {
+        Utils::List<TestElement> list;
+        TestElement first(1UL);
+        TestElement second(2UL);
+        TestElement third(3UL);
+
+        THEN ("the list shall be empty")
+        {
+            REQUIRE (list.IsEmpty() == true);
+            REQUIRE (list.GetFront() == 0);
+            REQUIRE (list.GetBack() == 0);
+            REQUIRE (list.PopFront() == 0);
+        }
+
+        WHEN ("the elements are linked")
+        {
+            bool errors = list.PushBack(second);
+            errors |= list.PushFront(first);
+            errors |= list.InsertAfter(second, third);
+
+            THEN ("there shall be no errors and the elements shall be in order")
+            {
+                REQUIRE (errors == false);
+                REQUIRE (list.GetCount() == 3U);
+                REQUIRE (list.GetFront() == &first);
+                REQUIRE (list.GetNext(first) == &second);
+                REQUIRE (list.GetNext(second) == &third);
+                REQUIRE (list.GetNext(third) == 0);
+                REQUIRE (list.GetBack() == &third);
+                REQUIRE (list.GetPrevious(third) == &second);
+                REQUIRE (list.GetPrevious(first) == 0);
+            }
+
+            AND_WHEN ("an element is linked twice")
+            {
+                errors = list.PushBack(first);
+
+                THEN ("an error shall be returned and the list shall not change")
+                {
+                    REQUIRE (errors == true);
+                    REQUIRE (list.GetCount() == 3U);
+                    REQUIRE (list.GetFront() == &first);
+                }
+            }
+
+            AND_WHEN ("the middle element is removed")
+            {
+                list.Remove(second);
+
+                THEN ("its neighbours shall be linked together")
+                {
+                    REQUIRE (list.GetCount() == 2U);
+                    REQUIRE (second.IsLinked() == false);
+                    REQUIRE (list.GetNext(first) == &third);
+                    REQUIRE (list.GetPrevious(third) == &first);
+                }
+
+                AND_WHEN ("it is removed again")
+                {
+                    list.Remove(second);
+
+                    THEN ("nothing shall happen")
+                    {
+                        REQUIRE (list.GetCount() == 2U);
+                    }
+                }
+            }
+
+            AND_WHEN ("the front element is popped")
+            {
+                TestElement* pElement = list.PopFront();
+
+                THEN ("the first element shall be returned and unlinked")
+                {
+                    REQUIRE (pElement == &first);
+                    REQUIRE (first.IsLinked() == false);
+                    REQUIRE (list.GetFront() == &second);
+                }
+            }
+
+            AND_WHEN ("the list is cleared")
+            {
+                list.Clear();
+
+                THEN ("all the elements shall be unlinked")
+                {
+                    REQUIRE (list.IsEmpty() == true);
+                    REQUIRE (first.IsLinked() == false);
+                    REQUIRE (second.IsLinked() == false);
+                    REQUIRE (third.IsLinked() == false);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE ("List remove benchmark", "[.benchmark]")
+{
+    static TestElement elements[benchmarkSize];
+    static TestElement* pointers[benchmarkSize];
+    Utils::List<TestElement> list;
+    std::size_t count = 0U;
+    uint32_t checksum = 0UL;
+
+    for (std::size_t i = 0U; i < benchmarkSize; ++i)
+    {
+        elements[i].number = i;
+        list.PushBack(elements[i]);
+        pointers[i] = &elements[i];
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        TestElement& element = elements[benchmarkSize / 2U];
+        list.Remove(element);
+        list.InsertAfter(*list.GetFront(), element);
+        checksum += list.GetNext(*list.GetFront())->number;
+    }
+    auto linked = std::chrono::steady_clock::now() - start;
+
+    count = benchmarkSize;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        TestElement* pElement = pointers[benchmarkSize / 2U];
+        for (std::size_t i = benchmarkSize / 2U; i < (count - 1U); ++i)
+        {
+            pointers[i] = pointers[i + 1U];
+        }
+        for (std::size_t i = count - 1U; i > 1U; --i)
+        {
+            pointers[i] = pointers[i - 1U];
+        }
+        pointers[1] = pElement;
+        checksum += pointers[1]->number;
+    }
+    auto shifted = std::chrono::steady_clock::now() - start;
+
+    WARN ("List remove and insert: " << std::chrono::duration_cast<std::chrono::microseconds>(linked).count() << " us");
+    WARN ("Array shift: " << std::chrono::duration_cast<std::chrono::microseconds>(shifted).count() << " us");
+    REQUIRE (list.GetCount() == benchmarkSize);
+    REQUIRE (checksum != 0UL);
+}
@@ -0,0 +1,267 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_Utils_Pool.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for Utils_Pool.hpp
+//! 
+//! The benchmark test case is hidden and is run with the [.benchmark] tag.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <fakeit.hpp>
+
+#include <Utils_Pool.hpp>
+
+#include <chrono>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+static int liveElements = 0;
+static int lockDepth = 0;
+static uint32_t lockCalls = 0UL;
+
+// An element type with a non-trivial constructor and destructor that counts its live instances.
+class TrackedElement
+{
+public:
+    TrackedElement(uint32_t value) : number(value)
+    {
+        ++liveElements;
+    }
+
+    ~TrackedElement(void)
+    {
+        --liveElements;
+    }
+
+    uint32_t number;
+};
+
+// A lock type that records its use.
+struct TestLock
+{
+    static void Lock(void)
+    {
+        ++lockDepth;
+        ++lockCalls;
+    }
+
+    static void Unlock(void)
+    {
+        --lockDepth;
+    }
+};
+
+static const std::size_t benchmarkSize = 32U;
+static const uint32_t benchmarkRounds = 100000UL;
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer allocates blocks from a pool", "[pool]")
+{
+    GIVEN ("a pool with statistics is created")
+    {
+        liveElements = 0;
+        lockDepth = 0;
+        lockCalls = 0UL;
+        Utils::Pool<TrackedElement, 3U, TestLock, true> pool;
+
+        THEN ("all the blocks shall be free")
+        {
+            static_assert(Utils::Pool<TrackedElement, 3U>::GetCapacity() == 3U, "Capacity is not constexpr.");
+            REQUIRE (pool.GetNumberOfFree() == 3U);
+            REQUIRE (pool.GetHighWaterMark() == 0U);
+            REQUIRE (pool.GetFailureCount() == 0UL);
+        }
+
+        WHEN ("every block is allocated")
+        {
+            lockCalls = 0UL;
+            TrackedElement* pElement0 = pool.Create(10UL);
+            TrackedElement* pElement1 = pool.Create(11UL);
+            TrackedElement* pElement2 = pool.Create(12UL);
+
+            THEN ("the blocks shall be distinct and the elements shall be constructed")
+            {
+                REQUIRE (pElement0 != 0);
+                REQUIRE (pElement1 != 0);
+                REQUIRE (pElement2 != 0);
+                REQUIRE (pElement0 != pElement1);
+                REQUIRE (pElement1 != pElement2);
+                REQUIRE (pElement2->number == 12UL);
+                REQUIRE (liveElements == 3);
+                REQUIRE (pool.GetNumberOfFree() == 0U);
+                REQUIRE (pool.GetHighWaterMark() == 3U);
+            }
+            AND_THEN ("the free list shall be locked once per allocation and released")
+            {
+                REQUIRE (lockCalls == 3UL);
+                REQUIRE (lockDepth == 0);
+            }
+            AND_THEN ("the blocks shall be found by their indexes")
+            {
+                std::size_t index = pool.GetIndex(pElement1);
+                REQUIRE (index < 3U);
+                REQUIRE (pool.GetElement(index) == pElement1);
+                REQUIRE (pool.GetElement(3U) == 0);
+            }
+
+            AND_WHEN ("one more block is allocated")
+            {
+                TrackedElement* pElement3 = pool.Create(13UL);
+
+                THEN ("no block shall be given and the failure shall be counted")
+                {
+                    REQUIRE (pElement3 == 0);
+                    REQUIRE (liveElements == 3);
+                    REQUIRE (pool.GetFailureCount() == 1UL);
+                }
+                AND_WHEN ("the statistics are reset")
+                {
+                    pool.ResetStatistics();
+
+                    THEN ("the failures shall be cleared and the high-water mark shall start from the current usage")
+                    {
+                        REQUIRE (pool.GetFailureCount() == 0UL);
+                        REQUIRE (pool.GetHighWaterMark() == 3U);
+                    }
+                }
+            }
+
+            AND_WHEN ("a block is destroyed and allocated again")
+            {
+                bool errors = pool.Destroy(pElement1);
+                TrackedElement* pElement3 = pool.Create(13UL);
+
+                THEN ("the freed block shall be reused")
+                {
+                    REQUIRE (errors == false);
+                    REQUIRE (pElement3 == pElement1);
+                    REQUIRE (pElement3->number == 13UL);
+                    REQUIRE (liveElements == 3);
+                    REQUIRE (pool.GetHighWaterMark() == 3U);
+                }
+            }
+
+            AND_WHEN ("the pool is reset")
+            {
+                pool.Reset();
+
+                THEN ("all the blocks and the statistics shall be reset")
+                {
+                    REQUIRE (pool.GetNumberOfFree() == 3U);
+                    REQUIRE (pool.GetHighWaterMark() == 0U);
+                }
+            }
+        }
+
+        WHEN ("a foreign pointer is freed")
+        {
+            TrackedElement element(1UL);
+            TrackedElement* pElement = pool.Create(2UL);
+            bool errors = pool.Free(&element);
+            errors = errors && pool.Destroy(&element);
+            errors = errors && pool.Free(reinterpret_cast<TrackedElement*>(reinterpret_cast<uint8_t*>(pElement) + 1U));
+
+            THEN ("an error shall be returned and the pool shall not change")
+            {
+                REQUIRE (errors == true);
+                REQUIRE (liveElements == 2);
+                REQUIRE (pool.GetNumberOfFree() == 2U);
+            }
+        }
+    }
+
+    GIVEN ("a pool without statistics is created")
+    {
+        Utils::Pool<uint32_t, 1U> pool;
+
+        WHEN ("the pool is exhausted")
+        {
+            uint32_t* pBlock = pool.Allocate();
+            uint32_t* pFailed = pool.Allocate();
+
+            THEN ("the allocation shall fail and the statistics shall read zero")
+            {
+                REQUIRE (pBlock != 0);
+                REQUIRE (pFailed == 0);
+                REQUIRE (pool.GetHighWaterMark() == 0U);
+                REQUIRE (pool.GetFailureCount() == 0UL);
+            }
+        }
+    }
+}
+
+TEST_CASE ("Pool allocation benchmark", "[.benchmark]")
+{
+    static Utils::Pool<uint64_t, benchmarkSize> pool;
+    uint64_t* pBlocks[benchmarkSize];
+    uint64_t checksum = 0U;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        for (std::size_t i = 0U; i < benchmarkSize; ++i)
+        {
+            pBlocks[i] = pool.Allocate();
+            *pBlocks[i] = round;
+        }
+        for (std::size_t i = 0U; i < benchmarkSize; ++i)
+        {
+            checksum += *pBlocks[i];
+            pool.Free(pBlocks[i]);
+        }
+    }
+    auto pooled = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        for (std::size_t i = 0U; i < benchmarkSize; ++i)
+        {
+            pBlocks[i] = new uint64_t(round);
+        }
+        for (std::size_t i = 0U; i < benchmarkSize; ++i)
+        {
+            checksum -= *pBlocks[i];
+            delete pBlocks[i];
+        }
+    }
+    auto heap = std::chrono::steady_clock::now() - start;
+
+    WARN ("Pool allocate and free: " << std::chrono::duration_cast<std::chrono::microseconds>(pooled).count() << " us");
+    WARN ("Heap new and delete: " << std::chrono::duration_cast<std::chrono::microseconds>(heap).count() << " us");
+    REQUIRE (checksum == 0U);
+}
@@ -50,6 +50,42 @@ typedef struct
     char character;
 } testStruct_t;
 
+bool operator==(testStruct_t const& lhs, testStruct_t const& rhs)
+{
+    return (lhs.number == rhs.number) && (lhs.character == rhs.character);
+}
+
+static int liveElements = 0;
+
+// An element type with a non-trivial constructor and destructor that counts its live instances.
+class TrackedElement
+{
+public:
+    TrackedElement(void) : number(0UL)
+    {
+        ++liveElements;
+    }
+
+    TrackedElement(uint32_t value) : number(value)
+    {
+        ++liveElements;
+    }
+
+    TrackedElement(TrackedElement const& other) : number(other.number)
+    {
+        ++liveElements;
+    }
+
+    TrackedElement& operator=(TrackedElement const& other) = default;
+
+    ~TrackedElement(void)
+    {
+        --liveElements;
+    }
+
+    uint32_t number;
+};
+
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------
@@ -212,6 +248,60 @@ SCENARIO ("Developer successfully uses queue", "[queue]")
             }
         }
 
+        WHEN ("the developer searches for a queued element")
+        {
+            testStruct_t searchedData = {.number = 2UL, .character = 'A'};
+            bool isFound = queue.Contains(searchedData);
+
+            THEN ("the element shall be found")
+            {
+                REQUIRE (isFound == true);
+            }
+        }
+
+        WHEN ("the developer searches for an element that is not queued")
+        {
+            testStruct_t searchedData = {.number = 2UL, .character = 'B'};
+            bool isFound = queue.Contains(searchedData);
+
+            THEN ("the element shall not be found")
+            {
+                REQUIRE (isFound == false);
+            }
+        }
+
+        WHEN ("the developer searches for a queued element among the newest elements only")
+        {
+            testStruct_t oldestData = {.number = 1UL, .character = 'J'};
+            testStruct_t newestData = {.number = 3UL, .character = 'S'};
+
+            THEN ("only the newest elements shall be compared")
+            {
+                REQUIRE (queue.Contains(oldestData, 2U) == false);
+                REQUIRE (queue.Contains(oldestData, 3U) == true);
+                REQUIRE (queue.Contains(newestData, 1U) == true);
+                REQUIRE (queue.Contains(newestData, 0U) == false);
+            }
+        }
+
+        WHEN ("the developer pops the first element and pushes another one over the end of the buffer")
+        {
+            errors = queue.Pop(testData);
+            testData = {.number = 4UL, .character = 'L'};
+            errors = queue.Push(testData);
+
+            THEN ("the popped element shall not be found")
+            {
+                testStruct_t searchedData = {.number = 1UL, .character = 'J'};
+                REQUIRE (queue.Contains(searchedData) == false);
+
+                AND_THEN ("the element pushed over the end of the buffer shall be found")
+                {
+                    REQUIRE (queue.Contains(testData) == true);
+                }
+            }
+        }
+
         WHEN ("the developer flushes the queue")
         {
             queue.Flush();
@@ -224,6 +314,238 @@ SCENARIO ("Developer successfully uses queue", "[queue]")
     }
 }
 
+SCENARIO ("Developer uses a queue of more than 255 elements", "[queue]")
+{
+    static_assert(std::is_same<Utils::IndexType<255U>::type, uint8_t>::value, "A small list shall use an 8-bit index.");
+    static_assert(std::is_same<Utils::IndexType<256U>::type, uint16_t>::value, "A medium list shall use a 16-bit index.");
+    static_assert(std::is_same<Utils::IndexType<65536U>::type, uint32_t>::value, "A large list shall use a 32-bit index.");
+
+    GIVEN ("a queue of 300 elements is created and empty")
+    {
+        static Utils::Queue<uint32_t, 300> queue;
+        queue.Flush();
+
+        WHEN ("the developer pushes 300 elements into the queue")
+        {
+            bool errors = false;
+            for (uint32_t i = 0UL; i < 300UL; ++i)
+            {
+                errors |= queue.Push(i);
+            }
+
+            THEN ("all the elements shall fit without wrapping the count around")
+            {
+                REQUIRE (errors == false);
+                REQUIRE (queue.GetNumberOfElements() == 300U);
+                REQUIRE (queue.Push(300UL) == true);
+            }
+            AND_WHEN ("the developer pops all the elements")
+            {
+                bool isInOrder = true;
+                for (uint32_t i = 0UL; i < 300UL; ++i)
+                {
+                    uint32_t element = 0UL;
+                    errors |= queue.Pop(element);
+                    isInOrder = isInOrder && (element == i);
+                }
+
+                THEN ("the elements shall be popped in order")
+                {
+                    REQUIRE (errors == false);
+                    REQUIRE (isInOrder == true);
+                    REQUIRE (queue.GetNumberOfElements() == 0U);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer uses in-place and batch queue operations", "[queue]")
+{
+    GIVEN ("a queue of non-trivial elements is created and empty")
+    {
+        liveElements = 0;
+        Utils::Queue<TrackedElement, 3> queue;
+
+        WHEN ("the developer emplaces two elements")
+        {
+            bool errors = queue.Emplace(1UL);
+            errors |= queue.Emplace(2UL);
+
+            THEN ("the elements shall be constructed in the queue")
+            {
+                REQUIRE (errors == false);
+                REQUIRE (liveElements == 2);
+                REQUIRE (queue.GetNumberOfElements() == 2U);
+            }
+            AND_WHEN ("the developer modifies the next element through a peek")
+            {
+                queue.Peek()->number = 10UL;
+
+                THEN ("the element shall be modified in place and not popped")
+                {
+                    REQUIRE (queue.Peek()->number == 10UL);
+                    REQUIRE (queue.GetNumberOfElements() == 2U);
+                    REQUIRE (liveElements == 2);
+                }
+            }
+            AND_WHEN ("the developer pops an element")
+            {
+                TrackedElement element;
+                errors = queue.Pop(element);
+
+                THEN ("the element shall be destroyed in the queue")
+                {
+                    REQUIRE (errors == false);
+                    REQUIRE (element.number == 1UL);
+                    REQUIRE (liveElements == 2);
+                }
+            }
+            AND_WHEN ("the developer flushes the queue")
+            {
+                queue.Flush();
+
+                THEN ("the elements shall be destroyed and nothing shall be peeked")
+                {
+                    REQUIRE (liveElements == 0);
+                    REQUIRE (queue.Peek() == 0);
+                }
+            }
+        }
+    }
+
+    GIVEN ("a queue of non-trivial elements holds elements when it goes out of scope")
+    {
+        liveElements = 0;
+        {
+            Utils::Queue<TrackedElement, 3> queue;
+            (void)queue.Emplace(1UL);
+            (void)queue.Emplace(2UL);
+        }
+
+        THEN ("the queued elements shall be destroyed with the queue")
+        {
+            REQUIRE (liveElements == 0);
+        }
+    }
+
+    GIVEN ("queues of trivially destructible elements")
+    {
+        THEN ("the queues shall be trivially destructible, so static queues need no destructor registration")
+        {
+            REQUIRE (std::is_trivially_destructible<Utils::Queue<uint32_t, 4> >::value == true);
+            REQUIRE (std::is_trivially_destructible<Utils::Queue<testStruct_t, 3> >::value == true);
+            REQUIRE (std::is_trivially_destructible<Utils::Queue<TrackedElement, 3> >::value == false);
+        }
+    }
+
+    GIVEN ("a queue of four elements is created and empty")
+    {
+        Utils::Queue<uint32_t, 4> queue;
+        const uint32_t input[] = {0UL, 1UL, 2UL, 3UL, 4UL, 5UL};
+        uint32_t output[6] = {0UL};
+
+        WHEN ("the developer pushes a batch of six elements")
+        {
+            std::size_t pushed = queue.PushBatch(input, 6U);
+
+            THEN ("as many elements as fit shall be pushed")
+            {
+                REQUIRE (pushed == 4U);
+                REQUIRE (queue.GetNumberOfElements() == 4U);
+            }
+            AND_WHEN ("the developer pops a batch of three elements and pushes two more over the end of the buffer")
+            {
+                std::size_t popped = queue.PopBatch(output, 3U);
+                pushed = queue.PushBatch(&input[4], 2U);
+
+                THEN ("the first elements shall be popped in order and the new elements shall wrap around")
+                {
+                    REQUIRE (popped == 3U);
+                    REQUIRE (output[0] == 0UL);
+                    REQUIRE (output[2] == 2UL);
+                    REQUIRE (pushed == 2U);
+                    REQUIRE (queue.GetNumberOfElements() == 3U);
+                }
+                AND_WHEN ("the developer pops a batch larger than the queue")
+                {
+                    popped = queue.PopBatch(output, 6U);
+
+                    THEN ("the remaining elements shall be popped in order")
+                    {
+                        REQUIRE (popped == 3U);
+                        REQUIRE (output[0] == 3UL);
+                        REQUIRE (output[1] == 4UL);
+                        REQUIRE (output[2] == 5UL);
+                        REQUIRE (queue.GetNumberOfElements() == 0U);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Developer uses a queue view over own storage", "[queue]")
+{
+    GIVEN ("a queue view is created over storage of three elements")
+    {
+        testStruct_t storage[3];
+        Utils::QueueView<testStruct_t> queue(storage, 3U);
+
+        WHEN ("four elements are pushed")
+        {
+            bool errors = queue.Push({.number = 1UL, .character = 'J'});
+            errors |= queue.Push({.number = 2UL, .character = 'A'});
+            errors |= queue.Push({.number = 3UL, .character = 'S'});
+            bool isFullError = queue.Push({.number = 4UL, .character = 'L'});
+
+            THEN ("the first three shall be queued and the last one shall be refused")
+            {
+                REQUIRE (errors == false);
+                REQUIRE (isFullError == true);
+                REQUIRE (queue.GetNumberOfElements() == 3U);
+                REQUIRE (queue.GetSize() == 3U);
+            }
+            AND_WHEN ("two elements are popped and two more are pushed")
+            {
+                testStruct_t element;
+                (void)queue.Pop(element);
+                (void)queue.Pop(element);
+                errors = queue.Push({.number = 5UL, .character = 'C'});
+                errors |= queue.Push({.number = 6UL, .character = 'H'});
+
+                THEN ("the elements shall be popped in FIFO order across the end of the storage")
+                {
+                    REQUIRE (errors == false);
+                    REQUIRE (queue.Pop(element) == false);
+                    REQUIRE (element.number == 3UL);
+                    REQUIRE (queue.Pop(element) == false);
+                    REQUIRE (element.number == 5UL);
+                    REQUIRE (queue.Pop(element) == false);
+                    REQUIRE (element.number == 6UL);
+                    REQUIRE (queue.Pop(element) == true);
+                }
+            }
+        }
+    }
+
+    GIVEN ("a queue view is created without storage")
+    {
+        Utils::QueueView<testStruct_t> queue;
+
+        WHEN ("an element is pushed")
+        {
+            bool errors = queue.Push({.number = 1UL, .character = 'J'});
+
+            THEN ("there shall be error")
+            {
+                REQUIRE (errors == true);
+                REQUIRE (queue.GetNumberOfElements() == 0U);
+            }
+        }
+    }
+}
+
 SCENARIO ("Developer misuses queue", "[queue]")
 {
     GIVEN ("The queue is created and full")
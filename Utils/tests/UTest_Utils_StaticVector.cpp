@@ -0,0 +1,256 @@
+//-----------------------------------------------------------------------------------------------------------------------------
+// Copyright (c) 2018 Juho Lepistö
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without 
+// limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+// TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+// CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+//! @file    UTest_Utils_StaticVector.cpp
+//! @author  Juho Lepistö juho.lepisto(a)gmail.com
+//! @date    18 Oct 2026
+//! 
+//! @brief   These are unit tests for Utils_StaticVector.hpp
+//! 
+//! The benchmark test case is hidden and is run with the [.benchmark] tag.
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 1. Include Files
+//-----------------------------------------------------------------------------------------------------------------------------
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <fakeit.hpp>
+
+#include <Utils_StaticVector.hpp>
+
+#include <chrono>
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 2. Test Structs and Variables
+//-----------------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+
+static int liveElements = 0;
+
+// An element type with a non-trivial constructor and destructor that counts its live instances.
+class TrackedElement
+{
+public:
+    TrackedElement(uint32_t value) : number(value)
+    {
+        ++liveElements;
+    }
+
+    TrackedElement(TrackedElement const& other) : number(other.number)
+    {
+        ++liveElements;
+    }
+
+    TrackedElement& operator=(TrackedElement const& other) = default;
+
+    ~TrackedElement(void)
+    {
+        --liveElements;
+    }
+
+    bool operator==(TrackedElement const& other) const
+    {
+        return (number == other.number);
+    }
+
+    uint32_t number;
+};
+
+static const std::size_t benchmarkSize = 200U;
+static const uint32_t benchmarkRounds = 20000UL;
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// 3. Test Cases
+//-----------------------------------------------------------------------------------------------------------------------------
+
+SCENARIO ("Developer uses a static vector", "[static_vector]")
+{
+    GIVEN ("a static vector is created")
+    {
+        liveElements = 0;
+        Utils::StaticVector<TrackedElement, 4U> vector;
+
+        THEN ("it shall be empty and the capacity shall be known at compile time")
+        {
+            static_assert(Utils::StaticVector<TrackedElement, 4U>::GetCapacity() == 4U, "Capacity is not constexpr.");
+            REQUIRE (vector.IsEmpty() == true);
+            REQUIRE (vector.GetSize() == 0U);
+            REQUIRE (liveElements == 0);
+        }
+
+        WHEN ("the vector is filled")
+        {
+            bool errors = false;
+            for (uint32_t i = 0UL; i < 4UL; ++i)
+            {
+                errors |= vector.EmplaceBack(i);
+            }
+
+            THEN ("there shall be no errors and the elements shall be constructed in order")
+            {
+                REQUIRE (errors == false);
+                REQUIRE (vector.IsFull() == true);
+                REQUIRE (liveElements == 4);
+                REQUIRE (vector[0].number == 0UL);
+                REQUIRE (vector[3].number == 3UL);
+            }
+
+            AND_WHEN ("one more element is pushed")
+            {
+                errors = vector.PushBack(TrackedElement(4UL));
+
+                THEN ("an error shall be returned and the vector shall not change")
+                {
+                    REQUIRE (errors == true);
+                    REQUIRE (vector.GetSize() == 4U);
+                    REQUIRE (liveElements == 4);
+                }
+            }
+
+            AND_WHEN ("an element is erased")
+            {
+                vector.Erase(1U);
+
+                THEN ("the order of the remaining elements shall be preserved")
+                {
+                    REQUIRE (vector.GetSize() == 3U);
+                    REQUIRE (liveElements == 3);
+                    REQUIRE (vector[0].number == 0UL);
+                    REQUIRE (vector[1].number == 2UL);
+                    REQUIRE (vector[2].number == 3UL);
+                }
+            }
+
+            AND_WHEN ("an element is erased unordered")
+            {
+                vector.EraseUnordered(1U);
+
+                THEN ("the last element shall take its place")
+                {
+                    REQUIRE (vector.GetSize() == 3U);
+                    REQUIRE (liveElements == 3);
+                    REQUIRE (vector[0].number == 0UL);
+                    REQUIRE (vector[1].number == 3UL);
+                    REQUIRE (vector[2].number == 2UL);
+                }
+            }
+
+            AND_WHEN ("an element is searched")
+            {
+                std::size_t found = vector.Find(TrackedElement(2UL));
+                std::size_t notFound = vector.Find(TrackedElement(7UL));
+
+                THEN ("the index of the element shall be returned, or the size if it is not found")
+                {
+                    REQUIRE (found == 2U);
+                    REQUIRE (notFound == vector.GetSize());
+                }
+            }
+
+            AND_WHEN ("the vector is iterated")
+            {
+                uint32_t sum = 0UL;
+                for (TrackedElement& element : vector)
+                {
+                    sum += element.number;
+                }
+
+                THEN ("all the elements shall be visited")
+                {
+                    REQUIRE (sum == 6UL);
+                }
+            }
+
+            AND_WHEN ("the vector is copied")
+            {
+                Utils::StaticVector<TrackedElement, 4U> copy(vector);
+
+                THEN ("the copy shall have its own elements")
+                {
+                    REQUIRE (copy.GetSize() == 4U);
+                    REQUIRE (liveElements == 8);
+                    REQUIRE (copy[3].number == 3UL);
+                }
+            }
+
+            AND_WHEN ("the vector is cleared")
+            {
+                vector.Clear();
+
+                THEN ("all the elements shall be destroyed")
+                {
+                    REQUIRE (vector.IsEmpty() == true);
+                    REQUIRE (liveElements == 0);
+                }
+            }
+        }
+
+        WHEN ("an out of range element is erased")
+        {
+            vector.PushBack(TrackedElement(1UL));
+            vector.Erase(5U);
+            vector.EraseUnordered(5U);
+
+            THEN ("nothing shall happen")
+            {
+                REQUIRE (vector.GetSize() == 1U);
+            }
+        }
+    }
+}
+
+TEST_CASE ("Static vector erase benchmark", "[.benchmark]")
+{
+    Utils::StaticVector<uint32_t, benchmarkSize> vector;
+    uint32_t checksum = 0UL;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        while (vector.IsFull() == false)
+        {
+            vector.PushBack(round);
+        }
+        vector.Erase(0U);
+        checksum += vector[0];
+    }
+    auto ordered = std::chrono::steady_clock::now() - start;
+
+    vector.Clear();
+    start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0UL; round < benchmarkRounds; ++round)
+    {
+        while (vector.IsFull() == false)
+        {
+            vector.PushBack(round);
+        }
+        vector.EraseUnordered(0U);
+        checksum += vector[0];
+    }
+    auto unordered = std::chrono::steady_clock::now() - start;
+
+    WARN ("Erase from front: " << std::chrono::duration_cast<std::chrono::microseconds>(ordered).count() << " us");
+    WARN ("EraseUnordered from front: " << std::chrono::duration_cast<std::chrono::microseconds>(unordered).count() << " us");
+    REQUIRE (checksum != 0UL);
+}